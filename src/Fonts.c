@@ -0,0 +1,1111 @@
+/**
+ * @file Fonts.c
+ *
+ * @brief Glyph tables of fonts used in Graphics and Gui modules.
+ *
+ * @details Tables are defined in this file only, so an image holds one copy of each whatever number of modules
+ * include Fonts.h. Size of every table is checked against its descriptor at compile time, tools/FontCheck.sh
+ * checks with nm that every table is linked once.
+ *
+ * Packed glyph starts with three bytes, leftmost ink column in the high nibble and ink width - 1 in the low
+ * nibble of the first, blank rows above ink in the second and number of ink rows in the third. Ink rows
+ * follow top one first as a bit stream read from bit 0 of each byte. Every row is a flag bit, 1 followed by
+ * ink width bits of the row, leftmost pixel first, or 0 repeating the row above. Rows below ink are blank,
+ * glyph without ink has no rows. Packed data ends with two padding bytes, so reading three bytes at once
+ * never leaves the table.
+ *
+ * @author Krzysztof Grzeszczak
+ *
+ * @version 1.0
+ *
+ * @date 2012-2013
+ *
+ * @copyright GNU Public License
+ */
+
+#include "Fonts.h"
+#include <stddef.h>
+
+//! Number of glyphs from ' ' to '~'
+#define FONTS_ASCII_COUNT		95
+
+//! Compile time check, array of negative size fails the build when condition is false
+#define FONTS_CHECK(name, condition)	typedef char name[(condition) ? 1 : -1]
+
+static unsigned short Fonts_ReverseBits(unsigned short bits);
+static unsigned short Fonts_ReadBits(FONT_READER_TYPE *Reader, unsigned char count);
+static bool Fonts_GetGlyph(const FONT_TYPE *Font, unsigned char ascii_char, unsigned short *glyph);
+
+#if (FONTS_PACKED == 0)
+/**
+  * @brief  ASCII font 16x24 table definition
+  */
+static const unsigned short Font_16p_Ascii_Table[] =
+{
+    /**
+      * @brief        Space ' '
+      */
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    /**
+      * @brief        '!'
+      */
+    0x0000, 0x0180, 0x0180, 0x0180, 0x0180, 0x0180, 0x0180, 0x0180,
+    0x0180, 0x0180, 0x0180, 0x0180, 0x0180, 0x0180, 0x0000, 0x0000,
+    0x0180, 0x0180, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    /**
+      * @brief        '"'
+      */
+    0x0000, 0x0000, 0x00CC, 0x00CC, 0x00CC, 0x00CC, 0x00CC, 0x00CC,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    /**
+      * @brief        '#'
+      */
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0C60, 0x0C60,
+    0x0C60, 0x0630, 0x0630, 0x1FFE, 0x1FFE, 0x0630, 0x0738, 0x0318,
+    0x1FFE, 0x1FFE, 0x0318, 0x0318, 0x018C, 0x018C, 0x018C, 0x0000,
+    /**
+      * @brief        '$'
+      */
+    0x0000, 0x0080, 0x03E0, 0x0FF8, 0x0E9C, 0x1C8C, 0x188C, 0x008C,
+    0x0098, 0x01F8, 0x07E0, 0x0E80, 0x1C80, 0x188C, 0x188C, 0x189C,
+    0x0CB8, 0x0FF0, 0x03E0, 0x0080, 0x0080, 0x0000, 0x0000, 0x0000,
+    /**
+      * @brief        '%'
+      */
+    0x0000, 0x0000, 0x0000, 0x180E, 0x0C1B, 0x0C11, 0x0611, 0x0611,
+    0x0311, 0x0311, 0x019B, 0x018E, 0x38C0, 0x6CC0, 0x4460, 0x4460,
+    0x4430, 0x4430, 0x4418, 0x6C18, 0x380C, 0x0000, 0x0000, 0x0000,
+    /**
+      * @brief        '&'
+      */
+    0x0000, 0x01E0, 0x03F0, 0x0738, 0x0618, 0x0618, 0x0330, 0x01F0,
+    0x00F0, 0x00F8, 0x319C, 0x330E, 0x1E06, 0x1C06, 0x1C06, 0x3F06,
+    0x73FC, 0x21F0, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    /**
+      * @brief        '''
+      */
+    0x0000, 0x0000, 0x000C, 0x000C, 0x000C, 0x000C, 0x000C, 0x000C,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    /**
+      * @brief        '('
+      */
+    0x0000, 0x0200, 0x0300, 0x0180, 0x00C0, 0x00C0, 0x0060, 0x0060,
+    0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030,
+    0x0060, 0x0060, 0x00C0, 0x00C0, 0x0180, 0x0300, 0x0200, 0x0000,
+    /**
+      * @brief        ')'
+      */
+    0x0000, 0x0020, 0x0060, 0x00C0, 0x0180, 0x0180, 0x0300, 0x0300,
+    0x0600, 0x0600, 0x0600, 0x0600, 0x0600, 0x0600, 0x0600, 0x0600,
+    0x0300, 0x0300, 0x0180, 0x0180, 0x00C0, 0x0060, 0x0020, 0x0000,
+    /**
+      * @brief        '*'
+      */
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x00C0, 0x00C0,
+    0x06D8, 0x07F8, 0x01E0, 0x0330, 0x0738, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    /**
+      * @brief        '+'
+      */
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0180, 0x0180,
+    0x0180, 0x0180, 0x0180, 0x3FFC, 0x3FFC, 0x0180, 0x0180, 0x0180,
+    0x0180, 0x0180, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    /**
+      * @brief        ','
+      */
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0180, 0x0180, 0x0100, 0x0100, 0x0080, 0x0000, 0x0000,
+    /**
+      * @brief        '-'
+      */
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x07E0, 0x07E0, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    /**
+      * @brief        '.'
+      */
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x00C0, 0x00C0, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    /**
+      * @brief        '/'
+      */
+    0x0000, 0x0C00, 0x0C00, 0x0600, 0x0600, 0x0600, 0x0300, 0x0300,
+    0x0300, 0x0380, 0x0180, 0x0180, 0x0180, 0x00C0, 0x00C0, 0x00C0,
+    0x0060, 0x0060, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    /**
+      * @brief        '0'
+      */
+    0x0000, 0x03E0, 0x07F0, 0x0E38, 0x0C18, 0x180C, 0x180C, 0x180C,
+    0x180C, 0x180C, 0x180C, 0x180C, 0x180C, 0x180C, 0x0C18, 0x0E38,
+    0x07F0, 0x03E0, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    /**
+      * @brief        '1'
+      */
+    0x0000, 0x0100, 0x0180, 0x01C0, 0x01F0, 0x0198, 0x0188, 0x0180,
+    0x0180, 0x0180, 0x0180, 0x0180, 0x0180, 0x0180, 0x0180, 0x0180,
+    0x0180, 0x0180, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    /**
+      * @brief        '2'
+      */
+    0x0000, 0x03E0, 0x0FF8, 0x0C18, 0x180C, 0x180C, 0x1800, 0x1800,
+    0x0C00, 0x0600, 0x0300, 0x0180, 0x00C0, 0x0060, 0x0030, 0x0018,
+    0x1FFC, 0x1FFC, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    /**
+      * @brief        '3'
+      */
+    0x0000, 0x01E0, 0x07F8, 0x0E18, 0x0C0C, 0x0C0C, 0x0C00, 0x0600,
+    0x03C0, 0x07C0, 0x0C00, 0x1800, 0x1800, 0x180C, 0x180C, 0x0C18,
+    0x07F8, 0x03E0, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    /**
+      * @brief        '4'
+      */
+    0x0000, 0x0C00, 0x0E00, 0x0F00, 0x0F00, 0x0D80, 0x0CC0, 0x0C60,
+    0x0C60, 0x0C30, 0x0C18, 0x0C0C, 0x3FFC, 0x3FFC, 0x0C00, 0x0C00,
+    0x0C00, 0x0C00, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    /**
+      * @brief        '5'
+      */
+    0x0000, 0x0FF8, 0x0FF8, 0x0018, 0x0018, 0x000C, 0x03EC, 0x07FC,
+    0x0E1C, 0x1C00, 0x1800, 0x1800, 0x1800, 0x180C, 0x0C1C, 0x0E18,
+    0x07F8, 0x03E0, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    /**
+      * @brief        '6'
+      */
+    0x0000, 0x07C0, 0x0FF0, 0x1C38, 0x1818, 0x0018, 0x000C, 0x03CC,
+    0x0FEC, 0x0E3C, 0x1C1C, 0x180C, 0x180C, 0x180C, 0x1C18, 0x0E38,
+    0x07F0, 0x03E0, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    /**
+      * @brief        '7'
+      */
+    0x0000, 0x1FFC, 0x1FFC, 0x0C00, 0x0600, 0x0600, 0x0300, 0x0380,
+    0x0180, 0x01C0, 0x00C0, 0x00E0, 0x0060, 0x0060, 0x0070, 0x0030,
+    0x0030, 0x0030, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    /**
+      * @brief        '8'
+      */
+    0x0000, 0x03E0, 0x07F0, 0x0E38, 0x0C18, 0x0C18, 0x0C18, 0x0638,
+    0x07F0, 0x07F0, 0x0C18, 0x180C, 0x180C, 0x180C, 0x180C, 0x0C38,
+    0x0FF8, 0x03E0, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    /**
+      * @brief        '9'
+      */
+    0x0000, 0x03E0, 0x07F0, 0x0E38, 0x0C1C, 0x180C, 0x180C, 0x180C,
+    0x1C1C, 0x1E38, 0x1BF8, 0x19E0, 0x1800, 0x0C00, 0x0C00, 0x0E1C,
+    0x07F8, 0x01F0, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    /**
+      * @brief        ':'
+      */
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0180, 0x0180,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0180, 0x0180, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    /**
+      * @brief        ';'
+      */
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0180, 0x0180,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0180, 0x0180, 0x0100, 0x0100, 0x0080, 0x0000, 0x0000, 0x0000,
+    /**
+      * @brief        '<'
+      */
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x1000, 0x1C00, 0x0F80, 0x03E0, 0x00F8, 0x0018, 0x00F8, 0x03E0,
+    0x0F80, 0x1C00, 0x1000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    /**
+      * @brief        '='
+      */
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x1FF8, 0x0000, 0x0000, 0x0000, 0x1FF8, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    /**
+      * @brief        '>'
+      */
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0008, 0x0038, 0x01F0, 0x07C0, 0x1F00, 0x1800, 0x1F00, 0x07C0,
+    0x01F0, 0x0038, 0x0008, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    /**
+      * @brief        '?'
+      */
+    0x0000, 0x03E0, 0x0FF8, 0x0C18, 0x180C, 0x180C, 0x1800, 0x0C00,
+    0x0600, 0x0300, 0x0180, 0x00C0, 0x00C0, 0x00C0, 0x0000, 0x0000,
+    0x00C0, 0x00C0, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    /**
+      * @brief        '@'
+      */
+    0x0000, 0x0000, 0x07E0, 0x1818, 0x2004, 0x29C2, 0x4A22, 0x4411,
+    0x4409, 0x4409, 0x4409, 0x2209, 0x1311, 0x0CE2, 0x4002, 0x2004,
+    0x1818, 0x07E0, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    /**
+      * @brief        'A'
+      */
+    0x0000, 0x0380, 0x0380, 0x06C0, 0x06C0, 0x06C0, 0x0C60, 0x0C60,
+    0x1830, 0x1830, 0x1830, 0x3FF8, 0x3FF8, 0x701C, 0x600C, 0x600C,
+    0xC006, 0xC006, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    /**
+      * @brief        'B'
+      */
+    0x0000, 0x03FC, 0x0FFC, 0x0C0C, 0x180C, 0x180C, 0x180C, 0x0C0C,
+    0x07FC, 0x0FFC, 0x180C, 0x300C, 0x300C, 0x300C, 0x300C, 0x180C,
+    0x1FFC, 0x07FC, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    /**
+      * @brief        'C'
+      */
+    0x0000, 0x07C0, 0x1FF0, 0x3838, 0x301C, 0x700C, 0x6006, 0x0006,
+    0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x6006, 0x700C, 0x301C,
+    0x1FF0, 0x07E0, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    /**
+      * @brief        'D'
+      */
+    0x0000, 0x03FE, 0x0FFE, 0x0E06, 0x1806, 0x1806, 0x3006, 0x3006,
+    0x3006, 0x3006, 0x3006, 0x3006, 0x3006, 0x1806, 0x1806, 0x0E06,
+    0x0FFE, 0x03FE, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    /**
+      * @brief        'E'
+      */
+    0x0000, 0x3FFC, 0x3FFC, 0x000C, 0x000C, 0x000C, 0x000C, 0x000C,
+    0x1FFC, 0x1FFC, 0x000C, 0x000C, 0x000C, 0x000C, 0x000C, 0x000C,
+    0x3FFC, 0x3FFC, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    /**
+      * @brief        'F'
+      */
+    0x0000, 0x3FF8, 0x3FF8, 0x0018, 0x0018, 0x0018, 0x0018, 0x0018,
+    0x1FF8, 0x1FF8, 0x0018, 0x0018, 0x0018, 0x0018, 0x0018, 0x0018,
+    0x0018, 0x0018, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    /**
+      * @brief        'G'
+      */
+    0x0000, 0x0FE0, 0x3FF8, 0x783C, 0x600E, 0xE006, 0xC007, 0x0003,
+    0x0003, 0xFE03, 0xFE03, 0xC003, 0xC007, 0xC006, 0xC00E, 0xF03C,
+    0x3FF8, 0x0FE0, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    /**
+      * @brief        'H'
+      */
+    0x0000, 0x300C, 0x300C, 0x300C, 0x300C, 0x300C, 0x300C, 0x300C,
+    0x3FFC, 0x3FFC, 0x300C, 0x300C, 0x300C, 0x300C, 0x300C, 0x300C,
+    0x300C, 0x300C, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    /**
+      * @brief        'I'
+      */
+    0x0000, 0x0180, 0x0180, 0x0180, 0x0180, 0x0180, 0x0180, 0x0180,
+    0x0180, 0x0180, 0x0180, 0x0180, 0x0180, 0x0180, 0x0180, 0x0180,
+    0x0180, 0x0180, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    /**
+      * @brief        'J'
+      */
+    0x0000, 0x0600, 0x0600, 0x0600, 0x0600, 0x0600, 0x0600, 0x0600,
+    0x0600, 0x0600, 0x0600, 0x0600, 0x0600, 0x0618, 0x0618, 0x0738,
+    0x03F0, 0x01E0, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    /**
+      * @brief        'K'
+      */
+    0x0000, 0x3006, 0x1806, 0x0C06, 0x0606, 0x0306, 0x0186, 0x00C6,
+    0x0066, 0x0076, 0x00DE, 0x018E, 0x0306, 0x0606, 0x0C06, 0x1806,
+    0x3006, 0x6006, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    /**
+      * @brief        'L'
+      */
+    0x0000, 0x0018, 0x0018, 0x0018, 0x0018, 0x0018, 0x0018, 0x0018,
+    0x0018, 0x0018, 0x0018, 0x0018, 0x0018, 0x0018, 0x0018, 0x0018,
+    0x1FF8, 0x1FF8, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    /**
+      * @brief        'M'
+      */
+    0x0000, 0xE00E, 0xF01E, 0xF01E, 0xF01E, 0xD836, 0xD836, 0xD836,
+    0xD836, 0xCC66, 0xCC66, 0xCC66, 0xC6C6, 0xC6C6, 0xC6C6, 0xC6C6,
+    0xC386, 0xC386, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    /**
+      * @brief        'N'
+      */
+    0x0000, 0x300C, 0x301C, 0x303C, 0x303C, 0x306C, 0x306C, 0x30CC,
+    0x30CC, 0x318C, 0x330C, 0x330C, 0x360C, 0x360C, 0x3C0C, 0x3C0C,
+    0x380C, 0x300C, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    /**
+      * @brief        'O'
+      */
+    0x0000, 0x07E0, 0x1FF8, 0x381C, 0x700E, 0x6006, 0xC003, 0xC003,
+    0xC003, 0xC003, 0xC003, 0xC003, 0xC003, 0x6006, 0x700E, 0x381C,
+    0x1FF8, 0x07E0, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    /**
+      * @brief        'P'
+      */
+    0x0000, 0x0FFC, 0x1FFC, 0x380C, 0x300C, 0x300C, 0x300C, 0x300C,
+    0x180C, 0x1FFC, 0x07FC, 0x000C, 0x000C, 0x000C, 0x000C, 0x000C,
+    0x000C, 0x000C, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    /**
+      * @brief        'Q'
+      */
+    0x0000, 0x07E0, 0x1FF8, 0x381C, 0x700E, 0x6006, 0xE003, 0xC003,
+    0xC003, 0xC003, 0xC003, 0xC003, 0xE007, 0x6306, 0x3F0E, 0x3C1C,
+    0x3FF8, 0xF7E0, 0xC000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    /**
+      * @brief        'R'
+      */
+    0x0000, 0x0FFE, 0x1FFE, 0x3806, 0x3006, 0x3006, 0x3006, 0x3806,
+    0x1FFE, 0x07FE, 0x0306, 0x0606, 0x0C06, 0x1806, 0x1806, 0x3006,
+    0x3006, 0x6006, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    /**
+      * @brief        'S'
+      */
+    0x0000, 0x03E0, 0x0FF8, 0x0C1C, 0x180C, 0x180C, 0x000C, 0x001C,
+    0x03F8, 0x0FE0, 0x1E00, 0x3800, 0x3006, 0x3006, 0x300E, 0x1C1C,
+    0x0FF8, 0x07E0, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    /**
+      * @brief        'T'
+      */
+    0x0000, 0x7FFE, 0x7FFE, 0x0180, 0x0180, 0x0180, 0x0180, 0x0180,
+    0x0180, 0x0180, 0x0180, 0x0180, 0x0180, 0x0180, 0x0180, 0x0180,
+    0x0180, 0x0180, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    /**
+      * @brief        'U'
+      */
+    0x0000, 0x300C, 0x300C, 0x300C, 0x300C, 0x300C, 0x300C, 0x300C,
+    0x300C, 0x300C, 0x300C, 0x300C, 0x300C, 0x300C, 0x300C, 0x1818,
+    0x1FF8, 0x07E0, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    /**
+      * @brief        'V'
+      */
+    0x0000, 0x6003, 0x3006, 0x3006, 0x3006, 0x180C, 0x180C, 0x180C,
+    0x0C18, 0x0C18, 0x0E38, 0x0630, 0x0630, 0x0770, 0x0360, 0x0360,
+    0x01C0, 0x01C0, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    /**
+      * @brief        'W'
+      */
+    0x0000, 0x6003, 0x61C3, 0x61C3, 0x61C3, 0x3366, 0x3366, 0x3366,
+    0x3366, 0x3366, 0x3366, 0x1B6C, 0x1B6C, 0x1B6C, 0x1A2C, 0x1E3C,
+    0x0E38, 0x0E38, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    /**
+      * @brief        'X'
+      */
+    0x0000, 0xE00F, 0x700C, 0x3018, 0x1830, 0x0C70, 0x0E60, 0x07C0,
+    0x0380, 0x0380, 0x03C0, 0x06E0, 0x0C70, 0x1C30, 0x1818, 0x300C,
+    0x600E, 0xE007, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    /**
+      * @brief        'Y'
+      */
+    0x0000, 0xC003, 0x6006, 0x300C, 0x381C, 0x1838, 0x0C30, 0x0660,
+    0x07E0, 0x03C0, 0x0180, 0x0180, 0x0180, 0x0180, 0x0180, 0x0180,
+    0x0180, 0x0180, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    /**
+      * @brief        'Z'
+      */
+    0x0000, 0x7FFC, 0x7FFC, 0x6000, 0x3000, 0x1800, 0x0C00, 0x0600,
+    0x0300, 0x0180, 0x00C0, 0x0060, 0x0030, 0x0018, 0x000C, 0x0006,
+    0x7FFE, 0x7FFE, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    /**
+      * @brief        '['
+      */
+    0x0000, 0x03E0, 0x03E0, 0x0060, 0x0060, 0x0060, 0x0060, 0x0060,
+    0x0060, 0x0060, 0x0060, 0x0060, 0x0060, 0x0060, 0x0060, 0x0060,
+    0x0060, 0x0060, 0x0060, 0x0060, 0x0060, 0x03E0, 0x03E0, 0x0000,
+    /**
+      * @brief        '\'
+      */
+    0x0000, 0x0030, 0x0030, 0x0060, 0x0060, 0x0060, 0x00C0, 0x00C0,
+    0x00C0, 0x01C0, 0x0180, 0x0180, 0x0180, 0x0300, 0x0300, 0x0300,
+    0x0600, 0x0600, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    /**
+      * @brief        ']'
+      */
+    0x0000, 0x03E0, 0x03E0, 0x0300, 0x0300, 0x0300, 0x0300, 0x0300,
+    0x0300, 0x0300, 0x0300, 0x0300, 0x0300, 0x0300, 0x0300, 0x0300,
+    0x0300, 0x0300, 0x0300, 0x0300, 0x0300, 0x03E0, 0x03E0, 0x0000,
+    /**
+      * @brief        '^'
+      */
+    0x0000, 0x0000, 0x01C0, 0x01C0, 0x0360, 0x0360, 0x0360, 0x0630,
+    0x0630, 0x0C18, 0x0C18, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    /**
+      * @brief        '_'
+      */
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0xFFFF, 0xFFFF, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    /**
+      * @brief        '''
+      */
+    0x0000, 0x000C, 0x000C, 0x000C, 0x000C, 0x000C, 0x000C, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    /**
+      * @brief        'a'
+      */
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x03F0, 0x07F8,
+    0x0C1C, 0x0C0C, 0x0F00, 0x0FF0, 0x0CF8, 0x0C0C, 0x0C0C, 0x0F1C,
+    0x0FF8, 0x18F0, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    /**
+      * @brief        'b'
+      */
+    0x0000, 0x0018, 0x0018, 0x0018, 0x0018, 0x0018, 0x03D8, 0x0FF8,
+    0x0C38, 0x1818, 0x1818, 0x1818, 0x1818, 0x1818, 0x1818, 0x0C38,
+    0x0FF8, 0x03D8, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    /**
+      * @brief        'c'
+      */
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x03C0, 0x07F0,
+    0x0E30, 0x0C18, 0x0018, 0x0018, 0x0018, 0x0018, 0x0C18, 0x0E30,
+    0x07F0, 0x03C0, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    /**
+      * @brief        'd'
+      */
+    0x0000, 0x1800, 0x1800, 0x1800, 0x1800, 0x1800, 0x1BC0, 0x1FF0,
+    0x1C30, 0x1818, 0x1818, 0x1818, 0x1818, 0x1818, 0x1818, 0x1C30,
+    0x1FF0, 0x1BC0, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    /**
+      * @brief        'e'
+      */
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x03C0, 0x0FF0,
+    0x0C30, 0x1818, 0x1FF8, 0x1FF8, 0x0018, 0x0018, 0x1838, 0x1C30,
+    0x0FF0, 0x07C0, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    /**
+      * @brief        'f'
+      */
+    0x0000, 0x0F80, 0x0FC0, 0x00C0, 0x00C0, 0x00C0, 0x07F0, 0x07F0,
+    0x00C0, 0x00C0, 0x00C0, 0x00C0, 0x00C0, 0x00C0, 0x00C0, 0x00C0,
+    0x00C0, 0x00C0, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    /**
+      * @brief        'g'
+      */
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0DE0, 0x0FF8,
+    0x0E18, 0x0C0C, 0x0C0C, 0x0C0C, 0x0C0C, 0x0C0C, 0x0C0C, 0x0E18,
+    0x0FF8, 0x0DE0, 0x0C00, 0x0C0C, 0x061C, 0x07F8, 0x01F0, 0x0000,
+    /**
+      * @brief        'h'
+      */
+    0x0000, 0x0018, 0x0018, 0x0018, 0x0018, 0x0018, 0x07D8, 0x0FF8,
+    0x1C38, 0x1818, 0x1818, 0x1818, 0x1818, 0x1818, 0x1818, 0x1818,
+    0x1818, 0x1818, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    /**
+      * @brief        'i'
+      */
+    0x0000, 0x00C0, 0x00C0, 0x0000, 0x0000, 0x0000, 0x00C0, 0x00C0,
+    0x00C0, 0x00C0, 0x00C0, 0x00C0, 0x00C0, 0x00C0, 0x00C0, 0x00C0,
+    0x00C0, 0x00C0, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    /**
+      * @brief        'j'
+      */
+    0x0000, 0x00C0, 0x00C0, 0x0000, 0x0000, 0x0000, 0x00C0, 0x00C0,
+    0x00C0, 0x00C0, 0x00C0, 0x00C0, 0x00C0, 0x00C0, 0x00C0, 0x00C0,
+    0x00C0, 0x00C0, 0x00C0, 0x00C0, 0x00C0, 0x00F8, 0x0078, 0x0000,
+    /**
+      * @brief        'k'
+      */
+    0x0000, 0x000C, 0x000C, 0x000C, 0x000C, 0x000C, 0x0C0C, 0x060C,
+    0x030C, 0x018C, 0x00CC, 0x006C, 0x00FC, 0x019C, 0x038C, 0x030C,
+    0x060C, 0x0C0C, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    /**
+      * @brief        'l'
+      */
+    0x0000, 0x00C0, 0x00C0, 0x00C0, 0x00C0, 0x00C0, 0x00C0, 0x00C0,
+    0x00C0, 0x00C0, 0x00C0, 0x00C0, 0x00C0, 0x00C0, 0x00C0, 0x00C0,
+    0x00C0, 0x00C0, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    /**
+      * @brief        'm'
+      */
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x3C7C, 0x7EFF,
+    0xE3C7, 0xC183, 0xC183, 0xC183, 0xC183, 0xC183, 0xC183, 0xC183,
+    0xC183, 0xC183, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    /**
+      * @brief        'n'
+      */
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0798, 0x0FF8,
+    0x1C38, 0x1818, 0x1818, 0x1818, 0x1818, 0x1818, 0x1818, 0x1818,
+    0x1818, 0x1818, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    /**
+      * @brief        'o'
+      */
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x03C0, 0x0FF0,
+    0x0C30, 0x1818, 0x1818, 0x1818, 0x1818, 0x1818, 0x1818, 0x0C30,
+    0x0FF0, 0x03C0, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    /**
+      * @brief        'p'
+      */
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x03D8, 0x0FF8,
+    0x0C38, 0x1818, 0x1818, 0x1818, 0x1818, 0x1818, 0x1818, 0x0C38,
+    0x0FF8, 0x03D8, 0x0018, 0x0018, 0x0018, 0x0018, 0x0018, 0x0000,
+    /**
+      * @brief        'q'
+      */
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x1BC0, 0x1FF0,
+    0x1C30, 0x1818, 0x1818, 0x1818, 0x1818, 0x1818, 0x1818, 0x1C30,
+    0x1FF0, 0x1BC0, 0x1800, 0x1800, 0x1800, 0x1800, 0x1800, 0x0000,
+    /**
+      * @brief        'r'
+      */
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x07B0, 0x03F0,
+    0x0070, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030,
+    0x0030, 0x0030, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    /**
+      * @brief        's'
+      */
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x03E0, 0x03F0,
+    0x0E38, 0x0C18, 0x0038, 0x03F0, 0x07C0, 0x0C00, 0x0C18, 0x0E38,
+    0x07F0, 0x03E0, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    /**
+      * @brief        't'
+      */
+    0x0000, 0x0000, 0x0080, 0x00C0, 0x00C0, 0x00C0, 0x07F0, 0x07F0,
+    0x00C0, 0x00C0, 0x00C0, 0x00C0, 0x00C0, 0x00C0, 0x00C0, 0x00C0,
+    0x07C0, 0x0780, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    /**
+      * @brief        'u'
+      */
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x1818, 0x1818,
+    0x1818, 0x1818, 0x1818, 0x1818, 0x1818, 0x1818, 0x1818, 0x1C38,
+    0x1FF0, 0x19E0, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    /**
+      * @brief        'v'
+      */
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x180C, 0x0C18,
+    0x0C18, 0x0C18, 0x0630, 0x0630, 0x0630, 0x0360, 0x0360, 0x0360,
+    0x01C0, 0x01C0, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    /**
+      * @brief        'w'
+      */
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x41C1, 0x41C1,
+    0x61C3, 0x6363, 0x6363, 0x6363, 0x3636, 0x3636, 0x3636, 0x1C1C,
+    0x1C1C, 0x1C1C, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    /**
+      * @brief        'x'
+      */
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x381C, 0x1C38,
+    0x0C30, 0x0660, 0x0360, 0x0360, 0x0360, 0x0360, 0x0660, 0x0C30,
+    0x1C38, 0x381C, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    /**
+      * @brief        'y'
+      */
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x3018, 0x1830,
+    0x1830, 0x1870, 0x0C60, 0x0C60, 0x0CE0, 0x06C0, 0x06C0, 0x0380,
+    0x0380, 0x0380, 0x0180, 0x0180, 0x01C0, 0x00F0, 0x0070, 0x0000,
+    /**
+      * @brief        'z'
+      */
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x1FFC, 0x1FFC,
+    0x0C00, 0x0600, 0x0300, 0x0180, 0x00C0, 0x0060, 0x0030, 0x0018,
+    0x1FFC, 0x1FFC, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    /**
+      * @brief        '{'
+      */
+    0x0000, 0x0300, 0x0180, 0x00C0, 0x00C0, 0x00C0, 0x00C0, 0x00C0,
+    0x00C0, 0x0060, 0x0060, 0x0030, 0x0060, 0x0040, 0x00C0, 0x00C0,
+    0x00C0, 0x00C0, 0x00C0, 0x00C0, 0x0180, 0x0300, 0x0000, 0x0000,
+    /**
+      * @brief        '|'
+      */
+    0x0000, 0x0180, 0x0180, 0x0180, 0x0180, 0x0180, 0x0180, 0x0180,
+    0x0180, 0x0180, 0x0180, 0x0180, 0x0180, 0x0180, 0x0180, 0x0180,
+    0x0180, 0x0180, 0x0180, 0x0180, 0x0180, 0x0180, 0x0180, 0x0000,
+    /**
+      * @brief        '}'
+      */
+    0x0000, 0x0060, 0x00C0, 0x01C0, 0x0180, 0x0180, 0x0180, 0x0180,
+    0x0180, 0x0300, 0x0300, 0x0600, 0x0300, 0x0100, 0x0180, 0x0180,
+    0x0180, 0x0180, 0x0180, 0x0180, 0x00C0, 0x0060, 0x0000, 0x0000,
+    /**
+      * @brief        '~'
+      */
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x10F0, 0x1FF8, 0x0F08, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000
+};
+
+/**
+  * @brief  ASCII font 12x12 table definition
+  */
+static const unsigned short Font_12p_Ascii_Table[] =
+{
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x0000, 0x2000, 0x0000, 0x0000,
+    0x0000, 0x5000, 0x5000, 0x5000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0900, 0x0900, 0x1200, 0x7f00, 0x1200, 0x7f00, 0x1200, 0x2400, 0x2400, 0x0000, 0x0000,
+    0x1000, 0x3800, 0x5400, 0x5000, 0x5000, 0x3800, 0x1400, 0x5400, 0x5400, 0x3800, 0x1000, 0x0000,
+    0x0000, 0x3080, 0x4900, 0x4900, 0x4a00, 0x32c0, 0x0520, 0x0920, 0x0920, 0x10c0, 0x0000, 0x0000,
+    0x0000, 0x0c00, 0x1200, 0x1200, 0x1400, 0x1800, 0x2500, 0x2300, 0x2300, 0x1d80, 0x0000, 0x0000,
+    0x0000, 0x4000, 0x4000, 0x4000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0800, 0x1000, 0x1000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x1000, 0x1000,
+    0x0000, 0x4000, 0x2000, 0x2000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x2000, 0x2000,
+    0x0000, 0x2000, 0x7000, 0x2000, 0x5000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0800, 0x0800, 0x7f00, 0x0800, 0x0800, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x2000, 0x2000, 0x4000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x7000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x2000, 0x0000, 0x0000,
+    0x0000, 0x1000, 0x1000, 0x1000, 0x2000, 0x2000, 0x2000, 0x2000, 0x4000, 0x4000, 0x0000, 0x0000,
+    0x0000, 0x1000, 0x2800, 0x4400, 0x4400, 0x4400, 0x4400, 0x4400, 0x2800, 0x1000, 0x0000, 0x0000,
+    0x0000, 0x1000, 0x3000, 0x5000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x0000, 0x0000,
+    0x0000, 0x3000, 0x4800, 0x4400, 0x0400, 0x0800, 0x1000, 0x2000, 0x4000, 0x7c00, 0x0000, 0x0000,
+    0x0000, 0x3000, 0x4800, 0x0400, 0x0800, 0x1000, 0x0800, 0x4400, 0x4800, 0x3000, 0x0000, 0x0000,
+    0x0000, 0x0800, 0x1800, 0x1800, 0x2800, 0x2800, 0x4800, 0x7c00, 0x0800, 0x0800, 0x0000, 0x0000,
+    0x0000, 0x3c00, 0x2000, 0x4000, 0x7000, 0x4800, 0x0400, 0x4400, 0x4800, 0x3000, 0x0000, 0x0000,
+    0x0000, 0x1800, 0x2400, 0x4000, 0x5000, 0x6800, 0x4400, 0x4400, 0x2800, 0x1000, 0x0000, 0x0000,
+    0x0000, 0x7c00, 0x0400, 0x0800, 0x1000, 0x1000, 0x1000, 0x2000, 0x2000, 0x2000, 0x0000, 0x0000,
+    0x0000, 0x1000, 0x2800, 0x4400, 0x2800, 0x1000, 0x2800, 0x4400, 0x2800, 0x1000, 0x0000, 0x0000,
+    0x0000, 0x1000, 0x2800, 0x4400, 0x4400, 0x2c00, 0x1400, 0x0400, 0x4800, 0x3000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x2000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x2000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x2000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x2000, 0x2000, 0x4000,
+    0x0000, 0x0000, 0x0400, 0x0800, 0x3000, 0x4000, 0x3000, 0x0800, 0x0400, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x7c00, 0x0000, 0x0000, 0x7c00, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x4000, 0x2000, 0x1800, 0x0400, 0x1800, 0x2000, 0x4000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x3800, 0x6400, 0x4400, 0x0400, 0x0800, 0x1000, 0x1000, 0x0000, 0x1000, 0x0000, 0x0000,
+    0x0000, 0x0f80, 0x1040, 0x2ea0, 0x51a0, 0x5120, 0x5120, 0x5120, 0x5320, 0x4dc0, 0x2020, 0x1040,
+    0x0000, 0x0800, 0x1400, 0x1400, 0x1400, 0x2200, 0x3e00, 0x2200, 0x4100, 0x4100, 0x0000, 0x0000,
+    0x0000, 0x3c00, 0x2200, 0x2200, 0x2200, 0x3c00, 0x2200, 0x2200, 0x2200, 0x3c00, 0x0000, 0x0000,
+    0x0000, 0x0e00, 0x1100, 0x2100, 0x2000, 0x2000, 0x2000, 0x2100, 0x1100, 0x0e00, 0x0000, 0x0000,
+    0x0000, 0x3c00, 0x2200, 0x2100, 0x2100, 0x2100, 0x2100, 0x2100, 0x2200, 0x3c00, 0x0000, 0x0000,
+    0x0000, 0x3e00, 0x2000, 0x2000, 0x2000, 0x3e00, 0x2000, 0x2000, 0x2000, 0x3e00, 0x0000, 0x0000,
+    0x0000, 0x3e00, 0x2000, 0x2000, 0x2000, 0x3c00, 0x2000, 0x2000, 0x2000, 0x2000, 0x0000, 0x0000,
+    0x0000, 0x0e00, 0x1100, 0x2100, 0x2000, 0x2700, 0x2100, 0x2100, 0x1100, 0x0e00, 0x0000, 0x0000,
+    0x0000, 0x2100, 0x2100, 0x2100, 0x2100, 0x3f00, 0x2100, 0x2100, 0x2100, 0x2100, 0x0000, 0x0000,
+    0x0000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x0000, 0x0000,
+    0x0000, 0x0800, 0x0800, 0x0800, 0x0800, 0x0800, 0x0800, 0x4800, 0x4800, 0x3000, 0x0000, 0x0000,
+    0x0000, 0x2200, 0x2400, 0x2800, 0x2800, 0x3800, 0x2800, 0x2400, 0x2400, 0x2200, 0x0000, 0x0000,
+    0x0000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x3e00, 0x0000, 0x0000,
+    0x0000, 0x2080, 0x3180, 0x3180, 0x3180, 0x2a80, 0x2a80, 0x2a80, 0x2a80, 0x2480, 0x0000, 0x0000,
+    0x0000, 0x2100, 0x3100, 0x3100, 0x2900, 0x2900, 0x2500, 0x2300, 0x2300, 0x2100, 0x0000, 0x0000,
+    0x0000, 0x0c00, 0x1200, 0x2100, 0x2100, 0x2100, 0x2100, 0x2100, 0x1200, 0x0c00, 0x0000, 0x0000,
+    0x0000, 0x3c00, 0x2200, 0x2200, 0x2200, 0x3c00, 0x2000, 0x2000, 0x2000, 0x2000, 0x0000, 0x0000,
+    0x0000, 0x0c00, 0x1200, 0x2100, 0x2100, 0x2100, 0x2100, 0x2100, 0x1600, 0x0d00, 0x0100, 0x0000,
+    0x0000, 0x3e00, 0x2100, 0x2100, 0x2100, 0x3e00, 0x2400, 0x2200, 0x2100, 0x2080, 0x0000, 0x0000,
+    0x0000, 0x1c00, 0x2200, 0x2200, 0x2000, 0x1c00, 0x0200, 0x2200, 0x2200, 0x1c00, 0x0000, 0x0000,
+    0x0000, 0x3e00, 0x0800, 0x0800, 0x0800, 0x0800, 0x0800, 0x0800, 0x0800, 0x0800, 0x0000, 0x0000,
+    0x0000, 0x2100, 0x2100, 0x2100, 0x2100, 0x2100, 0x2100, 0x2100, 0x1200, 0x0c00, 0x0000, 0x0000,
+    0x0000, 0x4100, 0x4100, 0x2200, 0x2200, 0x2200, 0x1400, 0x1400, 0x1400, 0x0800, 0x0000, 0x0000,
+    0x0000, 0x4440, 0x4a40, 0x2a40, 0x2a80, 0x2a80, 0x2a80, 0x2a80, 0x2a80, 0x1100, 0x0000, 0x0000,
+    0x0000, 0x4100, 0x2200, 0x1400, 0x1400, 0x0800, 0x1400, 0x1400, 0x2200, 0x4100, 0x0000, 0x0000,
+    0x0000, 0x4100, 0x2200, 0x2200, 0x1400, 0x0800, 0x0800, 0x0800, 0x0800, 0x0800, 0x0000, 0x0000,
+    0x0000, 0x7e00, 0x0200, 0x0400, 0x0800, 0x1000, 0x1000, 0x2000, 0x4000, 0x7e00, 0x0000, 0x0000,
+    0x0000, 0x3000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000,
+    0x0000, 0x4000, 0x4000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x1000, 0x1000, 0x0000, 0x0000,
+    0x0000, 0x6000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000,
+    0x0000, 0x1000, 0x2800, 0x2800, 0x2800, 0x4400, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x7e00,
+    0x4000, 0x2000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x3800, 0x4400, 0x0400, 0x3c00, 0x4400, 0x4400, 0x3c00, 0x0000, 0x0000,
+    0x0000, 0x4000, 0x4000, 0x5800, 0x6400, 0x4400, 0x4400, 0x4400, 0x6400, 0x5800, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x3000, 0x4800, 0x4000, 0x4000, 0x4000, 0x4800, 0x3000, 0x0000, 0x0000,
+    0x0000, 0x0400, 0x0400, 0x3400, 0x4c00, 0x4400, 0x4400, 0x4400, 0x4c00, 0x3400, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x3800, 0x4400, 0x4400, 0x7c00, 0x4000, 0x4400, 0x3800, 0x0000, 0x0000,
+    0x0000, 0x6000, 0x4000, 0xe000, 0x4000, 0x4000, 0x4000, 0x4000, 0x4000, 0x4000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x3400, 0x4c00, 0x4400, 0x4400, 0x4400, 0x4c00, 0x3400, 0x0400, 0x4400,
+    0x0000, 0x4000, 0x4000, 0x5800, 0x6400, 0x4400, 0x4400, 0x4400, 0x4400, 0x4400, 0x0000, 0x0000,
+    0x0000, 0x4000, 0x0000, 0x4000, 0x4000, 0x4000, 0x4000, 0x4000, 0x4000, 0x4000, 0x0000, 0x0000,
+    0x0000, 0x4000, 0x0000, 0x4000, 0x4000, 0x4000, 0x4000, 0x4000, 0x4000, 0x4000, 0x4000, 0x4000,
+    0x0000, 0x4000, 0x4000, 0x4800, 0x5000, 0x6000, 0x5000, 0x5000, 0x4800, 0x4800, 0x0000, 0x0000,
+    0x0000, 0x4000, 0x4000, 0x4000, 0x4000, 0x4000, 0x4000, 0x4000, 0x4000, 0x4000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x5200, 0x6d00, 0x4900, 0x4900, 0x4900, 0x4900, 0x4900, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x5800, 0x6400, 0x4400, 0x4400, 0x4400, 0x4400, 0x4400, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x3800, 0x4400, 0x4400, 0x4400, 0x4400, 0x4400, 0x3800, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x5800, 0x6400, 0x4400, 0x4400, 0x4400, 0x6400, 0x5800, 0x4000, 0x4000,
+    0x0000, 0x0000, 0x0000, 0x3400, 0x4c00, 0x4400, 0x4400, 0x4400, 0x4c00, 0x3400, 0x0400, 0x0400,
+    0x0000, 0x0000, 0x0000, 0x5000, 0x6000, 0x4000, 0x4000, 0x4000, 0x4000, 0x4000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x3000, 0x4800, 0x4000, 0x3000, 0x0800, 0x4800, 0x3000, 0x0000, 0x0000,
+    0x0000, 0x4000, 0x4000, 0xe000, 0x4000, 0x4000, 0x4000, 0x4000, 0x4000, 0x6000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x4400, 0x4400, 0x4400, 0x4400, 0x4400, 0x4c00, 0x3400, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x4400, 0x4400, 0x2800, 0x2800, 0x2800, 0x2800, 0x1000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x4900, 0x4900, 0x5500, 0x5500, 0x5500, 0x5500, 0x2200, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x4400, 0x2800, 0x2800, 0x1000, 0x2800, 0x2800, 0x4400, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x4400, 0x4400, 0x2800, 0x2800, 0x2800, 0x1000, 0x1000, 0x1000, 0x1000,
+    0x0000, 0x0000, 0x0000, 0x7800, 0x0800, 0x1000, 0x2000, 0x2000, 0x4000, 0x7800, 0x0000, 0x0000,
+    0x0000, 0x1000, 0x2000, 0x2000, 0x2000, 0x2000, 0x4000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000,
+    0x0000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000,
+    0x0000, 0x4000, 0x2000, 0x2000, 0x2000, 0x2000, 0x1000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x7400, 0x5800, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000
+};
+
+static const unsigned char Font_8p_Ascii_Table[] =
+{
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x10,0x10,0x10,0x10,0x10,0x10,0x00,0x10,0x00,
+    0x00,0x00,0x00,0x28,0x28,0x28,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x14,0x14,0x3e,0x14,0x28,0x7c,0x28,0x28,0x00,
+    0x00,0x00,0x10,0x38,0x54,0x50,0x38,0x14,0x14,0x54,0x38,0x10,
+    0x00,0x00,0x00,0x44,0xa8,0xa8,0x50,0x14,0x1a,0x2a,0x24,0x00,
+    0x00,0x00,0x00,0x20,0x50,0x50,0x20,0xe8,0x98,0x98,0x60,0x00,
+    0x00,0x00,0x00,0x80,0x80,0x80,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x40,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,
+    0x00,0x00,0x00,0x80,0x40,0x40,0x40,0x40,0x40,0x40,0x40,0x40,
+    0x00,0x00,0x00,0x40,0xe0,0x40,0xa0,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x20,0x20,0xf8,0x20,0x20,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x40,0x40,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xc0,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x40,0x00,
+    0x00,0x00,0x00,0x20,0x20,0x20,0x40,0x40,0x80,0x80,0x80,0x00,
+    0x00,0x00,0x00,0x60,0x90,0x90,0x90,0x90,0x90,0x90,0x60,0x00,
+    0x00,0x00,0x00,0x20,0x60,0xa0,0x20,0x20,0x20,0x20,0x20,0x00,
+    0x00,0x00,0x00,0x60,0x90,0x10,0x10,0x20,0x40,0x80,0xf0,0x00,
+    0x00,0x00,0x00,0x60,0x90,0x10,0x60,0x10,0x10,0x90,0x60,0x00,
+    0x00,0x00,0x00,0x10,0x30,0x50,0x50,0x90,0xf8,0x10,0x10,0x00,
+    0x00,0x00,0x00,0x70,0x40,0x80,0xe0,0x10,0x10,0x90,0x60,0x00,
+    0x00,0x00,0x00,0x60,0x90,0x80,0xa0,0xd0,0x90,0x90,0x60,0x00,
+    0x00,0x00,0x00,0xf0,0x10,0x20,0x20,0x20,0x40,0x40,0x40,0x00,
+    0x00,0x00,0x00,0x60,0x90,0x90,0x60,0x90,0x90,0x90,0x60,0x00,
+    0x00,0x00,0x00,0x60,0x90,0x90,0xb0,0x50,0x10,0x90,0x60,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x40,0x00,0x00,0x00,0x00,0x40,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x40,0x00,0x00,0x00,0x00,0x40,0x40,
+    0x00,0x00,0x00,0x00,0x00,0x10,0x60,0x80,0x60,0x10,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0xf0,0x00,0xf0,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x80,0x60,0x10,0x60,0x80,0x00,0x00,
+    0x00,0x00,0x00,0x60,0x90,0x10,0x20,0x40,0x40,0x00,0x40,0x00,
+    0x00,0x00,0x00,0x1c,0x22,0x5b,0xa5,0xa5,0xa5,0xa5,0x9e,0x41,
+    0x00,0x00,0x00,0x20,0x50,0x50,0x50,0x50,0x70,0x88,0x88,0x00,
+    0x00,0x00,0x00,0xf0,0x88,0x88,0xf0,0x88,0x88,0x88,0xf0,0x00,
+    0x00,0x00,0x00,0x38,0x44,0x84,0x80,0x80,0x84,0x44,0x38,0x00,
+    0x00,0x00,0x00,0xe0,0x90,0x88,0x88,0x88,0x88,0x90,0xe0,0x00,
+    0x00,0x00,0x00,0xf8,0x80,0x80,0xf8,0x80,0x80,0x80,0xf8,0x00,
+    0x00,0x00,0x00,0x78,0x40,0x40,0x70,0x40,0x40,0x40,0x40,0x00,
+    0x00,0x00,0x00,0x38,0x44,0x84,0x80,0x9c,0x84,0x44,0x38,0x00,
+    0x00,0x00,0x00,0x88,0x88,0x88,0xf8,0x88,0x88,0x88,0x88,0x00,
+    0x00,0x00,0x00,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x00,
+    0x00,0x00,0x00,0x10,0x10,0x10,0x10,0x10,0x90,0x90,0x60,0x00,
+    0x00,0x00,0x00,0x88,0x90,0xa0,0xe0,0xa0,0x90,0x90,0x88,0x00,
+    0x00,0x00,0x00,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0xf0,0x00,
+    0x00,0x00,0x00,0x82,0xc6,0xc6,0xaa,0xaa,0xaa,0xaa,0x92,0x00,
+    0x00,0x00,0x00,0x84,0xc4,0xa4,0xa4,0x94,0x94,0x8c,0x84,0x00,
+    0x00,0x00,0x00,0x30,0x48,0x84,0x84,0x84,0x84,0x48,0x30,0x00,
+    0x00,0x00,0x00,0xf0,0x88,0x88,0x88,0xf0,0x80,0x80,0x80,0x00,
+    0x00,0x00,0x00,0x30,0x48,0x84,0x84,0x84,0x84,0x58,0x34,0x04,
+    0x00,0x00,0x00,0x78,0x44,0x44,0x78,0x50,0x48,0x44,0x42,0x00,
+    0x00,0x00,0x00,0x70,0x88,0x80,0x70,0x08,0x88,0x88,0x70,0x00,
+    0x00,0x00,0x00,0xf8,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x00,
+    0x00,0x00,0x00,0x84,0x84,0x84,0x84,0x84,0x84,0x48,0x30,0x00,
+    0x00,0x00,0x00,0x88,0x88,0x50,0x50,0x50,0x50,0x50,0x20,0x00,
+    0x00,0x00,0x00,0x92,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0x44,0x00,
+    0x00,0x00,0x00,0x84,0x48,0x48,0x30,0x30,0x48,0x48,0x84,0x00,
+    0x00,0x00,0x00,0x88,0x50,0x50,0x20,0x20,0x20,0x20,0x20,0x00,
+    0x00,0x00,0x00,0xf8,0x08,0x10,0x20,0x20,0x40,0x80,0xf8,0x00,
+    0x00,0x00,0x00,0xc0,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,
+    0x00,0x00,0x00,0x80,0x80,0x40,0x40,0x40,0x40,0x20,0x20,0x00,
+    0x00,0x00,0x00,0xc0,0x40,0x40,0x40,0x40,0x40,0x40,0x40,0x40,
+    0x00,0x00,0x00,0x40,0xa0,0xa0,0xa0,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xf8,
+    0x00,0x00,0x00,0x80,0x40,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0xe0,0x10,0x70,0x90,0x90,0x70,0x00,
+    0x00,0x00,0x00,0x80,0x80,0xa0,0xd0,0x90,0x90,0xd0,0xa0,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x60,0x90,0x80,0x80,0x90,0x60,0x00,
+    0x00,0x00,0x00,0x10,0x10,0x50,0xb0,0x90,0x90,0xb0,0x50,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x60,0x90,0xf0,0x80,0x90,0x60,0x00,
+    0x00,0x00,0x00,0xc0,0x80,0xc0,0x80,0x80,0x80,0x80,0x80,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x50,0xb0,0x90,0x90,0xb0,0x50,0x10,
+    0x00,0x00,0x00,0x80,0x80,0xa0,0xd0,0x90,0x90,0x90,0x90,0x00,
+    0x00,0x00,0x00,0x80,0x00,0x80,0x80,0x80,0x80,0x80,0x80,0x00,
+    0x00,0x00,0x00,0x80,0x00,0x80,0x80,0x80,0x80,0x80,0x80,0x80,
+    0x00,0x00,0x00,0x80,0x80,0x90,0xa0,0xc0,0xa0,0x90,0x90,0x00,
+    0x00,0x00,0x00,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x00,
+    0x00,0x00,0x00,0x00,0x00,0xa6,0xda,0x92,0x92,0x92,0x92,0x00,
+    0x00,0x00,0x00,0x00,0x00,0xa0,0xd0,0x90,0x90,0x90,0x90,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x60,0x90,0x90,0x90,0x90,0x60,0x00,
+    0x00,0x00,0x00,0x00,0x00,0xa0,0xd0,0x90,0x90,0xd0,0xa0,0x80,
+    0x00,0x00,0x00,0x00,0x00,0x50,0xb0,0x90,0x90,0xb0,0x50,0x10,
+    0x00,0x00,0x00,0x00,0x00,0xa0,0xc0,0x80,0x80,0x80,0x80,0x00,
+    0x00,0x00,0x00,0x00,0x00,0xe0,0x90,0x40,0x20,0x90,0x60,0x00,
+    0x00,0x00,0x00,0x80,0x80,0xc0,0x80,0x80,0x80,0x80,0xc0,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x90,0x90,0x90,0x90,0xb0,0x50,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x88,0x88,0x50,0x50,0x50,0x20,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x92,0xaa,0xaa,0xaa,0xaa,0x44,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x88,0x50,0x20,0x20,0x50,0x88,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x88,0x50,0x50,0x50,0x20,0x20,0x20,
+    0x00,0x00,0x00,0x00,0x00,0xf0,0x10,0x20,0x40,0x80,0xf0,0x00,
+    0x00,0x00,0x00,0xc0,0x80,0x80,0x80,0x00,0x80,0x80,0x80,0x80,
+    0x00,0x00,0x00,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,
+    0x00,0x00,0x00,0xc0,0x40,0x40,0x40,0x20,0x40,0x40,0x40,0x40,
+    0x00,0x00,0x00,0x00,0x00,0x00,0xe8,0xb0,0x00,0x00,0x00,0x00
+};
+
+/**
+  * @brief  ASCII font 8x12: each character is 8 column (8dots large) and 12 raw (12 dots high)
+  */
+static const unsigned char Font_8p_bold_Ascii_Table[] =
+{
+    0x00,  0x00,  0x00,  0x00,  0x00,  0x00,  0x00,  0x00,  0x00,  0x00,  0x00,  0x00,   /* ' ' 32 */
+    0x00,  0x18,  0x3C,  0x3C,  0x3C,  0x18,  0x18,  0x00,  0x18,  0x18,  0x00,  0x00,   /* '!' 33 */
+    0x36,  0x36,  0x36,  0x14,  0x00,  0x00,  0x00,  0x00,  0x00,  0x00,  0x00,  0x00,   /* '"' 34 */
+    0x00,  0x6C,  0x6C,  0x6C,  0xFE,  0x6C,  0x6C,  0xFE,  0x6C,  0x6C,  0x00,  0x00,   /* '#' 35 */
+    0x18,  0x18,  0x7C,  0xC6,  0xC0,  0x78,  0x3C,  0x06,  0xC6,  0x7C,  0x18,  0x18,   /* '$' 36 */
+    0x00,  0x00,  0x00,  0x62,  0x66,  0x0C,  0x18,  0x30,  0x66,  0xC6,  0x00,  0x00,   /* '%' 37 */
+    0x00,  0x38,  0x6C,  0x38,  0x38,  0x76,  0xF6,  0xCE,  0xCC,  0x76,  0x00,  0x00,   /* '&' 38 */
+    0x0C,  0x0C,  0x0C,  0x18,  0x00,  0x00,  0x00,  0x00,  0x00,  0x00,  0x00,  0x00,   /* ''' 39 */
+    0x00,  0x0C,  0x18,  0x30,  0x30,  0x30,  0x30,  0x30,  0x18,  0x0C,  0x00,  0x00,   /* '(' 40 */
+    0x00,  0x30,  0x18,  0x0C,  0x0C,  0x0C,  0x0C,  0x0C,  0x18,  0x30,  0x00,  0x00,   /* ')' 41 */
+    0x00,  0x00,  0x00,  0x6C,  0x38,  0xFE,  0x38,  0x6C,  0x00,  0x00,  0x00,  0x00,   /* '*' 42 */
+    0x00,  0x00,  0x00,  0x18,  0x18,  0x7E,  0x18,  0x18,  0x00,  0x00,  0x00,  0x00,   /* '+' 43 */
+    0x00,  0x00,  0x00,  0x00,  0x00,  0x00,  0x00,  0x0C,  0x0C,  0x0C,  0x18,  0x00,   /* ',' 44 */
+    0x00,  0x00,  0x00,  0x00,  0x00,  0xFE,  0x00,  0x00,  0x00,  0x00,  0x00,  0x00,   /* '-' 45 */
+    0x00,  0x00,  0x00,  0x00,  0x00,  0x00,  0x00,  0x00,  0x18,  0x18,  0x00,  0x00,   /* '.' 46 */
+    0x00,  0x00,  0x02,  0x06,  0x0C,  0x18,  0x30,  0x60,  0xC0,  0x80,  0x00,  0x00,   /* '/' 47 */
+    0x00,  0x7C,  0xC6,  0xCE,  0xDE,  0xF6,  0xE6,  0xC6,  0xC6,  0x7C,  0x00,  0x00,   /* '0' 48 */
+    0x00,  0x18,  0x78,  0x18,  0x18,  0x18,  0x18,  0x18,  0x18,  0x7E,  0x00,  0x00,   /* '1' 49 */
+    0x00,  0x7C,  0xC6,  0xC6,  0x0C,  0x18,  0x30,  0x60,  0xC6,  0xFE,  0x00,  0x00,   /* '2' 50 */
+    0x00,  0x7C,  0xC6,  0x06,  0x06,  0x3C,  0x06,  0x06,  0xC6,  0x7C,  0x00,  0x00,   /* '3' 51 */
+    0x00,  0x0C,  0x1C,  0x3C,  0x6C,  0xCC,  0xFE,  0x0C,  0x0C,  0x0C,  0x00,  0x00,   /* '4' 52 */
+    0x00,  0xFE,  0xC0,  0xC0,  0xC0,  0xFC,  0x06,  0x06,  0xC6,  0x7C,  0x00,  0x00,   /* '5' 53 */
+    0x00,  0x7C,  0xC6,  0xC0,  0xC0,  0xFC,  0xC6,  0xC6,  0xC6,  0x7C,  0x00,  0x00,   /* '6' 54 */
+    0x00,  0xFE,  0xC6,  0x0C,  0x18,  0x30,  0x30,  0x30,  0x30,  0x30,  0x00,  0x00,   /* '7' 55 */
+    0x00,  0x7C,  0xC6,  0xC6,  0xC6,  0x7C,  0xC6,  0xC6,  0xC6,  0x7C,  0x00,  0x00,   /* '8' 56 */
+    0x00,  0x7C,  0xC6,  0xC6,  0xC6,  0x7E,  0x06,  0x06,  0xC6,  0x7C,  0x00,  0x00,   /* '9' 57 */
+    0x00,  0x00,  0x00,  0x0C,  0x0C,  0x00,  0x00,  0x0C,  0x0C,  0x00,  0x00,  0x00,   /* ':' 58 */
+    0x00,  0x00,  0x00,  0x0C,  0x0C,  0x00,  0x00,  0x0C,  0x0C,  0x0C,  0x18,  0x00,   /* ';' 59 */
+    0x00,  0x0C,  0x18,  0x30,  0x60,  0xC0,  0x60,  0x30,  0x18,  0x0C,  0x00,  0x00,   /* '<' 60 */
+    0x00,  0x00,  0x00,  0x00,  0xFE,  0x00,  0xFE,  0x00,  0x00,  0x00,  0x00,  0x00,   /* '=' 61 */
+    0x00,  0x60,  0x30,  0x18,  0x0C,  0x06,  0x0C,  0x18,  0x30,  0x60,  0x00,  0x00,   /* '>' 62 */
+    0x00,  0x7C,  0xC6,  0xC6,  0x0C,  0x18,  0x18,  0x00,  0x18,  0x18,  0x00,  0x00,   /* '?' 63 */
+    0x00,  0x7C,  0xC6,  0xC6,  0xDE,  0xDE,  0xDE,  0xDC,  0xC0,  0x7E,  0x00,  0x00,   /* '@' 64 */
+    0x00,  0x38,  0x6C,  0xC6,  0xC6,  0xC6,  0xFE,  0xC6,  0xC6,  0xC6,  0x00,  0x00,   /* 'A' 65 */
+    0x00,  0xFC,  0x66,  0x66,  0x66,  0x7C,  0x66,  0x66,  0x66,  0xFC,  0x00,  0x00,   /* 'B' 66 */
+    0x00,  0x3C,  0x66,  0xC0,  0xC0,  0xC0,  0xC0,  0xC0,  0x66,  0x3C,  0x00,  0x00,   /* 'C' 67 */
+    0x00,  0xF8,  0x6C,  0x66,  0x66,  0x66,  0x66,  0x66,  0x6C,  0xF8,  0x00,  0x00,   /* 'D' 68 */
+    0x00,  0xFE,  0x66,  0x60,  0x60,  0x7C,  0x60,  0x60,  0x66,  0xFE,  0x00,  0x00,   /* 'E' 69 */
+    0x00,  0xFE,  0x66,  0x60,  0x60,  0x7C,  0x60,  0x60,  0x60,  0xF0,  0x00,  0x00,   /* 'F' 70 */
+    0x00,  0x7C,  0xC6,  0xC6,  0xC0,  0xC0,  0xCE,  0xC6,  0xC6,  0x7C,  0x00,  0x00,   /* 'G' 71 */
+    0x00,  0xC6,  0xC6,  0xC6,  0xC6,  0xFE,  0xC6,  0xC6,  0xC6,  0xC6,  0x00,  0x00,   /* 'H' 72 */
+    0x00,  0x3C,  0x18,  0x18,  0x18,  0x18,  0x18,  0x18,  0x18,  0x3C,  0x00,  0x00,   /* 'I' 73 */
+    0x00,  0x3C,  0x18,  0x18,  0x18,  0x18,  0x18,  0xD8,  0xD8,  0x70,  0x00,  0x00,   /* 'J' 74 */
+    0x00,  0xC6,  0xCC,  0xD8,  0xF0,  0xF0,  0xD8,  0xCC,  0xC6,  0xC6,  0x00,  0x00,   /* 'K' 75 */
+    0x00,  0xF0,  0x60,  0x60,  0x60,  0x60,  0x60,  0x62,  0x66,  0xFE,  0x00,  0x00,   /* 'L' 76 */
+    0x00,  0xC6,  0xC6,  0xEE,  0xFE,  0xD6,  0xD6,  0xD6,  0xC6,  0xC6,  0x00,  0x00,   /* 'M' 77 */
+    0x00,  0xC6,  0xC6,  0xE6,  0xE6,  0xF6,  0xDE,  0xCE,  0xCE,  0xC6,  0x00,  0x00,   /* 'N' 78 */
+    0x00,  0x7C,  0xC6,  0xC6,  0xC6,  0xC6,  0xC6,  0xC6,  0xC6,  0x7C,  0x00,  0x00,   /* 'O' 79 */
+    0x00,  0xFC,  0x66,  0x66,  0x66,  0x7C,  0x60,  0x60,  0x60,  0xF0,  0x00,  0x00,   /* 'P' 80 */
+    0x00,  0x7C,  0xC6,  0xC6,  0xC6,  0xC6,  0xC6,  0xC6,  0xD6,  0x7C,  0x06,  0x00,   /* 'Q' 81 */
+    0x00,  0xFC,  0x66,  0x66,  0x66,  0x7C,  0x78,  0x6C,  0x66,  0xE6,  0x00,  0x00,   /* 'R' 82 */
+    0x00,  0x7C,  0xC6,  0xC0,  0x60,  0x38,  0x0C,  0x06,  0xC6,  0x7C,  0x00,  0x00,   /* 'S' 83 */
+    0x00,  0x7E,  0x5A,  0x18,  0x18,  0x18,  0x18,  0x18,  0x18,  0x3C,  0x00,  0x00,   /* 'T' 84 */
+    0x00,  0xC6,  0xC6,  0xC6,  0xC6,  0xC6,  0xC6,  0xC6,  0xC6,  0x7C,  0x00,  0x00,   /* 'U' 85 */
+    0x00,  0xC6,  0xC6,  0xC6,  0xC6,  0xC6,  0xC6,  0x6C,  0x38,  0x10,  0x00,  0x00,   /* 'V' 86 */
+    0x00,  0xC6,  0xC6,  0xD6,  0xD6,  0xD6,  0xFE,  0xEE,  0xC6,  0xC6,  0x00,  0x00,   /* 'W' 87 */
+    0x00,  0xC6,  0xC6,  0x6C,  0x38,  0x38,  0x38,  0x6C,  0xC6,  0xC6,  0x00,  0x00,   /* 'X' 88 */
+    0x00,  0x66,  0x66,  0x66,  0x66,  0x3C,  0x18,  0x18,  0x18,  0x3C,  0x00,  0x00,   /* 'Y' 89 */
+    0x00,  0xFE,  0xC6,  0x8C,  0x18,  0x30,  0x60,  0xC2,  0xC6,  0xFE,  0x00,  0x00,   /* 'Z' 90 */
+    0x00,  0x7C,  0x60,  0x60,  0x60,  0x60,  0x60,  0x60,  0x60,  0x7C,  0x00,  0x00,   /* '[' 91 */
+    0x00,  0x00,  0x80,  0xC0,  0x60,  0x30,  0x18,  0x0C,  0x06,  0x02,  0x00,  0x00,   /* '\' 92 */
+    0x00,  0x7C,  0x0C,  0x0C,  0x0C,  0x0C,  0x0C,  0x0C,  0x0C,  0x7C,  0x00,  0x00,   /* ']' 93 */
+    0x10,  0x38,  0x6C,  0xC6,  0x00,  0x00,  0x00,  0x00,  0x00,  0x00,  0x00,  0x00,   /* '^' 94 */
+    0x00,  0x00,  0x00,  0x00,  0x00,  0x00,  0x00,  0x00,  0x00,  0x00,  0x00,  0xFF,   /* '_' 95 */
+    0x18,  0x18,  0x18,  0x0C,  0x00,  0x00,  0x00,  0x00,  0x00,  0x00,  0x00,  0x00,   /* '`' 96 */
+    0x00,  0x00,  0x00,  0x00,  0x78,  0x0C,  0x7C,  0xCC,  0xDC,  0x76,  0x00,  0x00,   /* 'a' 97 */
+    0x00,  0xE0,  0x60,  0x60,  0x7C,  0x66,  0x66,  0x66,  0x66,  0xFC,  0x00,  0x00,   /* 'b' 98 */
+    0x00,  0x00,  0x00,  0x00,  0x7C,  0xC6,  0xC0,  0xC0,  0xC6,  0x7C,  0x00,  0x00,   /* 'c' 99 */
+    0x00,  0x1C,  0x0C,  0x0C,  0x7C,  0xCC,  0xCC,  0xCC,  0xCC,  0x7E,  0x00,  0x00,   /* 'd' 100 */
+    0x00,  0x00,  0x00,  0x00,  0x7C,  0xC6,  0xFE,  0xC0,  0xC6,  0x7C,  0x00,  0x00,   /* 'e' 101 */
+    0x00,  0x1C,  0x36,  0x30,  0x30,  0xFC,  0x30,  0x30,  0x30,  0x78,  0x00,  0x00,   /* 'f' 102 */
+    0x00,  0x00,  0x00,  0x00,  0x76,  0xCE,  0xC6,  0xC6,  0x7E,  0x06,  0xC6,  0x7C,   /* 'g' 103 */
+    0x00,  0xE0,  0x60,  0x60,  0x6C,  0x76,  0x66,  0x66,  0x66,  0xE6,  0x00,  0x00,   /* 'h' 104 */
+    0x00,  0x18,  0x18,  0x00,  0x38,  0x18,  0x18,  0x18,  0x18,  0x3C,  0x00,  0x00,   /* 'i' 105 */
+    0x00,  0x0C,  0x0C,  0x00,  0x1C,  0x0C,  0x0C,  0x0C,  0x0C,  0xCC,  0xCC,  0x78,   /* 'j' 106 */
+    0x00,  0xE0,  0x60,  0x60,  0x66,  0x6C,  0x78,  0x6C,  0x66,  0xE6,  0x00,  0x00,   /* 'k' 107 */
+    0x00,  0x38,  0x18,  0x18,  0x18,  0x18,  0x18,  0x18,  0x18,  0x3C,  0x00,  0x00,   /* 'l' 108 */
+    0x00,  0x00,  0x00,  0x00,  0x6C,  0xFE,  0xD6,  0xD6,  0xC6,  0xC6,  0x00,  0x00,   /* 'm' 109 */
+    0x00,  0x00,  0x00,  0x00,  0xDC,  0x66,  0x66,  0x66,  0x66,  0x66,  0x00,  0x00,   /* 'n' 110 */
+    0x00,  0x00,  0x00,  0x00,  0x7C,  0xC6,  0xC6,  0xC6,  0xC6,  0x7C,  0x00,  0x00,   /* 'o' 111 */
+    0x00,  0x00,  0x00,  0x00,  0xDC,  0x66,  0x66,  0x66,  0x7C,  0x60,  0x60,  0xF0,   /* 'p' 112 */
+    0x00,  0x00,  0x00,  0x00,  0x76,  0xCC,  0xCC,  0xCC,  0x7C,  0x0C,  0x0C,  0x1E,   /* 'q' 113 */
+    0x00,  0x00,  0x00,  0x00,  0xDC,  0x66,  0x60,  0x60,  0x60,  0xF0,  0x00,  0x00,   /* 'r' 114 */
+    0x00,  0x00,  0x00,  0x00,  0x7C,  0xC6,  0x70,  0x1C,  0xC6,  0x7C,  0x00,  0x00,   /* 's' 115 */
+    0x00,  0x30,  0x30,  0x30,  0xFC,  0x30,  0x30,  0x30,  0x36,  0x1C,  0x00,  0x00,   /* 't' 116 */
+    0x00,  0x00,  0x00,  0x00,  0xCC,  0xCC,  0xCC,  0xCC,  0xCC,  0x76,  0x00,  0x00,   /* 'u' 117 */
+    0x00,  0x00,  0x00,  0x00,  0xC6,  0xC6,  0xC6,  0x6C,  0x38,  0x10,  0x00,  0x00,   /* 'v' 118 */
+    0x00,  0x00,  0x00,  0x00,  0xC6,  0xC6,  0xD6,  0xD6,  0xFE,  0x6C,  0x00,  0x00,   /* 'w' 119 */
+    0x00,  0x00,  0x00,  0x00,  0xC6,  0x6C,  0x38,  0x38,  0x6C,  0xC6,  0x00,  0x00,   /* 'x' 120 */
+    0x00,  0x00,  0x00,  0x00,  0xC6,  0xC6,  0xC6,  0xCE,  0x76,  0x06,  0xC6,  0x7C,   /* 'y' 121 */
+    0x00,  0x00,  0x00,  0x00,  0xFE,  0x8C,  0x18,  0x30,  0x62,  0xFE,  0x00,  0x00,   /* 'z' 122 */
+    0x00,  0x0E,  0x18,  0x18,  0x18,  0x70,  0x18,  0x18,  0x18,  0x0E,  0x00,  0x00,   /* '{' 123 */
+    0x00,  0x18,  0x18,  0x18,  0x18,  0x00,  0x18,  0x18,  0x18,  0x18,  0x00,  0x00,   /* '|' 124 */
+    0x00,  0x70,  0x18,  0x18,  0x18,  0x0E,  0x18,  0x18,  0x18,  0x70,  0x00,  0x00,   /* '}' 125 */
+    0x00,  0x76,  0xDC,  0x00,  0x00,  0x00,  0x00,  0x00,  0x00,  0x00,  0x00,  0x00    /* '~' 126 */
+};
+
+//! Font descriptors in FONT_SIZE_TYPE order
+static const FONT_TYPE Fonts_Table[] =
+{
+	{FONT_8P_WIDTH, FONT_8P_HEIGHT, ' ', '~', TRUE, NULL, Font_8p_Ascii_Table, NULL, NULL, NULL},		//FONT_8P
+	{FONT_8P_WIDTH, FONT_8P_HEIGHT, ' ', '~', TRUE, NULL, Font_8p_bold_Ascii_Table, NULL, NULL, NULL},	//FONT_8P_BOLD
+	{FONT_12P_WIDTH, FONT_12P_HEIGHT, ' ', '~', TRUE, Font_12p_Ascii_Table, NULL, NULL, NULL, NULL},	//FONT_12P
+	{FONT_16P_WIDTH, FONT_16P_HEIGHT, ' ', '~', FALSE, Font_16p_Ascii_Table, NULL, NULL, NULL, NULL}	//FONT_16P
+};
+
+FONTS_CHECK(Fonts_Check16p, sizeof(Font_16p_Ascii_Table) == FONTS_ASCII_COUNT * FONT_16P_HEIGHT * sizeof(unsigned short));
+FONTS_CHECK(Fonts_Check12p, sizeof(Font_12p_Ascii_Table) == FONTS_ASCII_COUNT * FONT_12P_HEIGHT * sizeof(unsigned short));
+FONTS_CHECK(Fonts_Check8p, sizeof(Font_8p_Ascii_Table) == FONTS_ASCII_COUNT * FONT_8P_HEIGHT);
+FONTS_CHECK(Fonts_Check8pBold, sizeof(Font_8p_bold_Ascii_Table) == FONTS_ASCII_COUNT * FONT_8P_HEIGHT);
+#else
+#include "FontsPacked.h"
+#endif
+
+FONTS_CHECK(Fonts_CheckTable, sizeof(Fonts_Table) / sizeof(Fonts_Table[0]) == FONT_16P + 1);
+
+/**
+ * @brief Get descriptor of font
+ *
+ * @param font_size - FONT_SIZE_TYPE enumerated parameter
+ *
+ * @return pointer to font descriptor, NULL for unknown font
+ */
+const FONT_TYPE* Fonts_GetFont(FONT_SIZE_TYPE font_size)
+{
+	if( (unsigned int)font_size >= sizeof(Fonts_Table) / sizeof(Fonts_Table[0]) )
+	{
+		return NULL;
+	}
+
+	return &Fonts_Table[font_size];
+}
+
+/**
+ * @brief Get glyph row of character as mask, leftmost pixel in bit 0
+ *
+ * @details Packed glyph is decoded from its top row down to the row, use Fonts_ReadRow to go through all rows.
+ *
+ * @param Font - font descriptor returned by Fonts_GetFont
+ * @param ascii_char - ASCII code character, characters missing in font are blank
+ * @param row - glyph row, 0 is the bottom one
+ */
+unsigned short Fonts_GetRow(const FONT_TYPE *Font, unsigned char ascii_char, unsigned char row)
+{
+	FONT_READER_TYPE Reader;
+	unsigned short font_row, glyph, index;
+
+	if(Fonts_GetGlyph(Font, ascii_char, &glyph) == FALSE)
+	{
+		return 0;
+	}
+	index = glyph * Font->Height + row;
+
+	if(Font->PackedRows != NULL)
+	{
+		Fonts_OpenGlyph(&Reader, Font, ascii_char);
+		do
+		{
+			font_row = Fonts_ReadRow(&Reader);
+		} while(Reader.Row < Font->Height - row);
+		return font_row;
+	}
+
+	//Row aligned to 16 bits, leftmost pixel moved to bit 0
+	font_row = (Font->WideRows != NULL) ? Font->WideRows[index] : (unsigned short)(Font->NarrowRows[index] << 8);
+	return (Font->IsMsbFirst == TRUE) ? Fonts_ReverseBits(font_row) : font_row;
+}
+
+/**
+ * @brief Start reading glyph rows of character with Fonts_ReadRow
+ *
+ * @param Reader - reader to set up
+ * @param Font - font descriptor returned by Fonts_GetFont
+ * @param ascii_char - ASCII code character, characters missing in font are blank
+ */
+void Fonts_OpenGlyph(FONT_READER_TYPE *Reader, const FONT_TYPE *Font, unsigned char ascii_char)
+{
+	const unsigned char *data;
+	unsigned short glyph;
+
+	Reader->Font = Font;
+	Reader->Char = ascii_char;
+	Reader->Row = 0;
+	Reader->Left = 0;
+	Reader->InkWidth = 0;
+	Reader->Top = 0;
+	Reader->InkRows = 0;
+	Reader->Data = NULL;
+	Reader->Bit = 0;
+	Reader->Mask = 0;
+
+	if( (Font->PackedRows != NULL) && (Fonts_GetGlyph(Font, ascii_char, &glyph) == TRUE) )
+	{
+		data = &Font->PackedRows[Font->PackedIndex[glyph]];
+		Reader->Left = data[0] >> 4;
+		Reader->InkWidth = (data[0] & 0x0F) + 1;
+		Reader->Top = data[1];
+		Reader->InkRows = data[2];
+		Reader->Data = &data[3];
+	}
+}
+
+/**
+ * @brief Read next glyph row of character opened with Fonts_OpenGlyph, top row first
+ *
+ * @return glyph row as mask, leftmost pixel in bit 0
+ */
+unsigned short Fonts_ReadRow(FONT_READER_TYPE *Reader)
+{
+	const FONT_TYPE *Font = Reader->Font;
+	unsigned char row = Reader->Row++;
+
+	if(Font->PackedRows == NULL)
+	{
+		return Fonts_GetRow(Font, Reader->Char, Font->Height - 1 - row);
+	}
+
+	//Blank rows above and below ink are not stored
+	if( (row < Reader->Top) || (row >= Reader->Top + Reader->InkRows) )
+	{
+		return 0;
+	}
+
+	if(Fonts_ReadBits(Reader, 1) != 0)
+	{
+		Reader->Mask = Fonts_ReadBits(Reader, Reader->InkWidth) << Reader->Left;
+	}
+
+	return Reader->Mask;
+}
+
+/**
+ * @brief Find glyph of character in font
+ *
+ * @param glyph - set to position of glyph in font tables
+ *
+ * @return FALSE if font has no glyph for character
+ */
+bool Fonts_GetGlyph(const FONT_TYPE *Font, unsigned char ascii_char, unsigned short *glyph)
+{
+	const char *chars;
+
+	if( (ascii_char < Font->FirstChar) || (ascii_char > Font->LastChar) )
+	{
+		return FALSE;
+	}
+
+	if(Font->Chars == NULL)
+	{
+		*glyph = ascii_char - Font->FirstChar;
+		return TRUE;
+	}
+
+	//Subset of characters is short, list is searched from its start, LastChar ends the search at the latest
+	chars = Font->Chars;
+	while( (unsigned char)*chars < ascii_char )
+	{
+		chars++;
+	}
+
+	*glyph = chars - Font->Chars;
+	return ( (unsigned char)*chars == ascii_char ) ? TRUE : FALSE;
+}
+
+/**
+ * @brief Read count bits, 16 at most, from packed glyph, first bit read in bit 0
+ */
+unsigned short Fonts_ReadBits(FONT_READER_TYPE *Reader, unsigned char count)
+{
+	const unsigned char *data = &Reader->Data[Reader->Bit >> 3];
+	unsigned long bits;
+
+	//Up to 16 bits starting anywhere in a byte fit in three bytes
+	bits = ( data[0] | ((unsigned long)data[1] << 8) | ((unsigned long)data[2] << 16) ) >> (Reader->Bit & 0x07);
+	Reader->Bit += count;
+
+	return (unsigned short)(bits & ((1UL << count) - 1));
+}
+
+/**
+ * @brief Reverse order of 16 bits, so bit 15 becomes bit 0
+ */
+unsigned short Fonts_ReverseBits(unsigned short bits)
+{
+	bits = ( (bits & 0x5555) << 1 ) | ( (bits >> 1) & 0x5555 );
+	bits = ( (bits & 0x3333) << 2 ) | ( (bits >> 2) & 0x3333 );
+	bits = ( (bits & 0x0F0F) << 4 ) | ( (bits >> 4) & 0x0F0F );
+	return (unsigned short)( (bits << 8) | (bits >> 8) );
+}
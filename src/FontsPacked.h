@@ -0,0 +1,473 @@
+/**
+ * @file FontsPacked.h
+ *
+ * @brief Glyph tables packed to glyph bounds, generated by tools/FontPack.
+ *
+ * @details Included by Fonts.c only, when FONTS_PACKED is set. Run FontPack again instead of editing.
+ *
+ * Font_8p from Fonts.c, 95 glyphs
+ * Font_8p_bold from Fonts.c, 95 glyphs
+ * Font_12p from Fonts.c, 95 glyphs
+ * Font_16p from Fonts.c, 95 glyphs
+ */
+
+/**
+  * @brief  Font_8p glyphs, 8x12 cell, packed to glyph bounds
+  */
+static const unsigned char Font_8p_Packed_Rows[] =
+{
+	0x00, 0x00, 0x00,	/* ' ' 32 */
+	0x30, 0x01, 0x08, 0x37, 0x00,	/* '!' 33 */
+	0x22, 0x06, 0x03, 0x0B,	/* '"' 34 */
+	0x15, 0x01, 0x08, 0x15, 0xBF, 0x4A, 0xAA, 0x9F, 0x02,	/* '#' 35 */
+	0x14, 0x00, 0x0A, 0x49, 0xB7, 0xA6, 0xBA, 0x65, 0xED, 0x12,	/* '$' 36 */
+	0x06, 0x01, 0x08, 0x49, 0xA9, 0xB1, 0x51, 0x15, 0x2B, 0x8A, 0x00,	/* '%' 37 */
+	0x04, 0x01, 0x08, 0xCD, 0xEC, 0x4D, 0x2A, 0x09,	/* '&' 38 */
+	0x00, 0x06, 0x03, 0x03,	/* ''' 39 */
+	0x01, 0x00, 0x09, 0x03, 0x14,	/* '(' 40 */
+	0x01, 0x00, 0x09, 0x05, 0x0C,	/* ')' 41 */
+	0x02, 0x05, 0x04, 0x5B, 0x5F,	/* '*' 42 */
+	0x04, 0x02, 0x05, 0x89, 0x3F, 0x01,	/* '+' 43 */
+	0x10, 0x00, 0x02, 0x03,	/* ',' 44 */
+	0x01, 0x03, 0x01, 0x07,	/* '-' 45 */
+	0x10, 0x01, 0x01, 0x03,	/* '.' 46 */
+	0x02, 0x01, 0x08, 0x43, 0x49, 0x00,	/* '/' 47 */
+	0x03, 0x01, 0x08, 0x6D, 0x82, 0x06,	/* '0' 48 */
+	0x02, 0x01, 0x08, 0x09, 0xDB, 0x09,	/* '1' 49 */
+	0x03, 0x01, 0x08, 0x7F, 0x94, 0x14, 0xCD, 0x06,	/* '2' 50 */
+	0x03, 0x01, 0x08, 0x6D, 0x46, 0x2D, 0xCE, 0x06,	/* '3' 51 */
+	0x04, 0x01, 0x08, 0x91, 0x7F, 0xAA, 0x64, 0x11,	/* '4' 52 */
+	0x03, 0x01, 0x08, 0x6D, 0x46, 0x6F, 0x94, 0x0E,	/* '5' 53 */
+	0x03, 0x01, 0x08, 0x6D, 0xBA, 0x6B, 0xCC, 0x06,	/* '6' 54 */
+	0x03, 0x01, 0x08, 0x85, 0x44, 0xFC,	/* '7' 55 */
+	0x03, 0x01, 0x08, 0x6D, 0xD2, 0xA6, 0x06,	/* '8' 56 */
+	0x03, 0x01, 0x08, 0x6D, 0xC6, 0xBA, 0xA7, 0x06,	/* '9' 57 */
+	0x10, 0x01, 0x06, 0x87, 0x01,	/* ':' 58 */
+	0x10, 0x00, 0x07, 0x0B, 0x03,	/* ';' 59 */
+	0x03, 0x02, 0x05, 0xB1, 0x8D, 0x16, 0x01,	/* '<' 60 */
+	0x03, 0x03, 0x03, 0x3F, 0x7C,	/* '=' 61 */
+	0x03, 0x02, 0x05, 0xA3, 0xC5, 0x36, 0x00,	/* '>' 62 */
+	0x03, 0x01, 0x08, 0x25, 0x14, 0x29, 0xCE, 0x06,	/* '?' 63 */
+	0x07, 0x00, 0x09, 0x05, 0xE7, 0x2D, 0x45, 0xED, 0x44, 0x71, 0x00,	/* '@' 64 */
+	0x04, 0x01, 0x08, 0xA3, 0xAE, 0x42, 0x02,	/* 'A' 65 */
+	0x04, 0x01, 0x08, 0xDF, 0xC8, 0x37, 0xFA, 0x00,	/* 'B' 66 */
+	0x05, 0x01, 0x08, 0xB9, 0xE2, 0x70, 0x60, 0x58, 0xCC, 0x01,	/* 'C' 67 */
+	0x04, 0x01, 0x08, 0xCF, 0x34, 0x62, 0x7A, 0x00,	/* 'D' 68 */
+	0x04, 0x01, 0x08, 0xFF, 0xC0, 0x3F, 0xF8, 0x01,	/* 'E' 69 */
+	0x13, 0x01, 0x08, 0x03, 0x6F, 0xF8,	/* 'F' 70 */
+	0x05, 0x01, 0x08, 0xB9, 0xE2, 0x70, 0x3E, 0x18, 0x16, 0x73,	/* 'G' 71 */
+	0x04, 0x01, 0x08, 0x23, 0xFE, 0x11,	/* 'H' 72 */
+	0x00, 0x01, 0x08, 0x03, 0x00,	/* 'I' 73 */
+	0x03, 0x01, 0x08, 0x6D, 0x8A, 0x00,	/* 'J' 74 */
+	0x04, 0x01, 0x08, 0xE3, 0x64, 0x79, 0x96, 0x69, 0x04,	/* 'K' 75 */
+	0x03, 0x01, 0x08, 0x7F, 0x00,	/* 'L' 76 */
+	0x06, 0x01, 0x08, 0x93, 0xAB, 0x38, 0x36, 0x08,	/* 'M' 77 */
+	0x05, 0x01, 0x08, 0xC3, 0xF1, 0xD4, 0xD2, 0x71, 0x08,	/* 'N' 78 */
+	0x05, 0x01, 0x08, 0x99, 0xD2, 0x10, 0xA5, 0x0C,	/* 'O' 79 */
+	0x04, 0x01, 0x08, 0x03, 0xDF, 0xC8, 0x07,	/* 'P' 80 */
+	0x05, 0x00, 0x09, 0xC1, 0x6C, 0x6D, 0x88, 0x52, 0x06,	/* 'Q' 81 */
+	0x15, 0x01, 0x08, 0xC3, 0xD1, 0x64, 0xF1, 0x19, 0xF9, 0x00,	/* 'R' 82 */
+	0x04, 0x01, 0x08, 0xDD, 0x28, 0xEC, 0x86, 0xB1, 0x03,	/* 'S' 83 */
+	0x04, 0x01, 0x08, 0x09, 0xF0, 0x03,	/* 'T' 84 */
+	0x05, 0x01, 0x08, 0x99, 0xD2, 0x10, 0x00,	/* 'U' 85 */
+	0x04, 0x01, 0x08, 0x49, 0x05, 0x23,	/* 'V' 86 */
+	0x06, 0x01, 0x08, 0x45, 0xAB, 0x60, 0x12,	/* 'W' 87 */
+	0x05, 0x01, 0x08, 0xC3, 0x92, 0x8C, 0x92, 0x21,	/* 'X' 88 */
+	0x04, 0x01, 0x08, 0x09, 0x54, 0x46,	/* 'Y' 89 */
+	0x04, 0x01, 0x08, 0xFF, 0x50, 0x24, 0xA2, 0xF0, 0x07,	/* 'Z' 90 */
+	0x01, 0x00, 0x09, 0x03, 0x1C,	/* '[' 91 */
+	0x02, 0x01, 0x08, 0xA9, 0x30, 0x00,	/* '\' 92 */
+	0x01, 0x00, 0x09, 0x05, 0x1C,	/* ']' 93 */
+	0x02, 0x05, 0x04, 0x4B, 0x01,	/* '^' 94 */
+	0x04, 0x00, 0x01, 0x3F,	/* '_' 95 */
+	0x01, 0x07, 0x02, 0x1D,	/* '`' 96 */
+	0x03, 0x01, 0x06, 0x7D, 0xEA, 0xF1, 0x01,	/* 'a' 97 */
+	0x03, 0x01, 0x08, 0xEB, 0x4E, 0x77, 0x0D,	/* 'b' 98 */
+	0x03, 0x01, 0x06, 0x6D, 0x0E, 0xB3, 0x01,	/* 'c' 99 */
+	0x03, 0x01, 0x08, 0x75, 0x4F, 0xBB, 0x46,	/* 'd' 100 */
+	0x03, 0x01, 0x06, 0x6D, 0x8E, 0x3F, 0x1B,	/* 'e' 101 */
+	0x01, 0x01, 0x08, 0x83, 0xEF,	/* 'f' 102 */
+	0x03, 0x00, 0x07, 0xB1, 0xEE, 0x69, 0x57,	/* 'g' 103 */
+	0x03, 0x01, 0x08, 0x13, 0x77, 0x0D,	/* 'h' 104 */
+	0x00, 0x01, 0x08, 0x83, 0x06,	/* 'i' 105 */
+	0x00, 0x00, 0x09, 0x03, 0x0D,	/* 'j' 106 */
+	0x03, 0x01, 0x08, 0xD3, 0x3A, 0x6B, 0x0E,	/* 'k' 107 */
+	0x00, 0x01, 0x08, 0x03, 0x00,	/* 'l' 108 */
+	0x06, 0x01, 0x06, 0x93, 0xB8, 0x5D, 0x06,	/* 'm' 109 */
+	0x03, 0x01, 0x06, 0x13, 0x77, 0x01,	/* 'n' 110 */
+	0x03, 0x01, 0x06, 0x6D, 0xA2, 0x01,	/* 'o' 111 */
+	0x03, 0x00, 0x07, 0x63, 0xDD, 0xE9, 0x2E,	/* 'p' 112 */
+	0x03, 0x00, 0x07, 0xB1, 0xEE, 0x69, 0x57,	/* 'q' 113 */
+	0x02, 0x01, 0x06, 0x83, 0x5B,	/* 'r' 114 */
+	0x03, 0x01, 0x06, 0x6D, 0xA6, 0x32, 0x1F,	/* 's' 115 */
+	0x01, 0x01, 0x08, 0x1F, 0x3E,	/* 't' 116 */
+	0x03, 0x01, 0x06, 0x75, 0x4F, 0x00,	/* 'u' 117 */
+	0x04, 0x01, 0x06, 0x49, 0xC5, 0x08,	/* 'v' 118 */
+	0x06, 0x01, 0x06, 0x45, 0xAB, 0x98, 0x04,	/* 'w' 119 */
+	0x04, 0x01, 0x06, 0x63, 0x95, 0xA8, 0x46,	/* 'x' 120 */
+	0x04, 0x00, 0x07, 0x09, 0x15, 0x23,	/* 'y' 121 */
+	0x03, 0x01, 0x06, 0x7F, 0x94, 0x14, 0x3F,	/* 'z' 122 */
+	0x01, 0x00, 0x09, 0x43, 0xC6, 0x01,	/* '{' 123 */
+	0x00, 0x00, 0x09, 0x03, 0x00,	/* '|' 124 */
+	0x02, 0x00, 0x09, 0x85, 0x2C, 0x0E,	/* '}' 125 */
+	0x04, 0x04, 0x02, 0xDB, 0x0B,	/* '~' 126 */
+	0x00, 0x00,	/* padding */
+};
+
+static const unsigned short Font_8p_Packed_Index[] =
+{
+	0, 3, 8, 12, 21, 31, 42, 50, 54, 59, 64, 69, 75, 79, 83, 87,
+	93, 99, 105, 113, 121, 129, 137, 145, 151, 158, 166, 171, 176, 183, 188, 195,
+	203, 214, 221, 229, 239, 247, 255, 261, 271, 277, 282, 288, 297, 302, 310, 319,
+	327, 334, 343, 353, 362, 368, 375, 381, 388, 396, 402, 411, 416, 422, 427, 432,
+	436, 440, 447, 454, 461, 468, 475, 480, 487, 493, 498, 503, 510, 515, 522, 528,
+	534, 541, 548, 553, 560, 565, 571, 577, 584, 591, 597, 604, 610, 615, 621
+};
+
+/**
+  * @brief  Font_8p_bold glyphs, 8x12 cell, packed to glyph bounds
+  */
+static const unsigned char Font_8p_bold_Packed_Rows[] =
+{
+	0x00, 0x00, 0x00,	/* ' ' 32 */
+	0x23, 0x02, 0x09, 0x4D, 0x68, 0x3E, 0x0D,	/* '!' 33 */
+	0x24, 0x08, 0x04, 0xD5, 0x0D,	/* '"' 34 */
+	0x06, 0x02, 0x09, 0x6D, 0xFE, 0xDB, 0xFC, 0xB7, 0x01,	/* '#' 35 */
+	0x06, 0x00, 0x0C, 0x31, 0xFA, 0x8E, 0x83, 0xF3, 0x7A, 0x0E, 0x8E, 0xFB, 0x62, 0x00,	/* '$' 36 */
+	0x06, 0x02, 0x07, 0xC7, 0xCD, 0x19, 0x31, 0x61, 0xCD, 0x8D,	/* '%' 37 */
+	0x06, 0x02, 0x09, 0xDD, 0x67, 0xE7, 0xDF, 0xDD, 0x39, 0xDA, 0x72, 0x00,	/* '&' 38 */
+	0x32, 0x08, 0x04, 0xD7, 0x00,	/* ''' 39 */
+	0x23, 0x02, 0x09, 0xB9, 0x1D, 0x68, 0x19,	/* '(' 40 */
+	0x23, 0x02, 0x09, 0xA7, 0x65, 0x68, 0x07,	/* ')' 41 */
+	0x06, 0x04, 0x05, 0x6D, 0x39, 0xFF, 0x39, 0x6D,	/* '*' 42 */
+	0x15, 0x04, 0x05, 0x19, 0xFF, 0x0C,	/* '+' 43 */
+	0x32, 0x01, 0x04, 0xD7, 0x00,	/* ',' 44 */
+	0x06, 0x06, 0x01, 0xFF,	/* '-' 45 */
+	0x31, 0x02, 0x02, 0x07,	/* '.' 46 */
+	0x06, 0x02, 0x08, 0x03, 0x07, 0x0D, 0x19, 0x31, 0x61, 0xC1, 0x81,	/* '/' 47 */
+	0x06, 0x02, 0x09, 0x7D, 0xC7, 0x9E, 0xBF, 0xEF, 0xCF, 0x8F, 0xFB, 0x00,	/* '0' 48 */
+	0x15, 0x02, 0x09, 0xFF, 0x0C, 0xF8, 0x64, 0x00,	/* '1' 49 */
+	0x06, 0x02, 0x09, 0xFF, 0xC7, 0x0D, 0x19, 0x31, 0x61, 0xC7, 0xFA, 0x00,	/* '2' 50 */
+	0x06, 0x02, 0x09, 0x7D, 0xC7, 0xC1, 0xF2, 0x82, 0x1D, 0xF7, 0x01,	/* '3' 51 */
+	0x06, 0x02, 0x09, 0x61, 0xFC, 0x9F, 0xB5, 0xE5, 0xC5, 0x85, 0x01,	/* '4' 52 */
+	0x06, 0x02, 0x09, 0x7D, 0xC7, 0xC1, 0xFE, 0x0E, 0xF8, 0x07,	/* '5' 53 */
+	0x06, 0x02, 0x09, 0x7D, 0xC7, 0xFC, 0x1D, 0x38, 0xEE, 0x03,	/* '6' 54 */
+	0x06, 0x02, 0x09, 0x19, 0x10, 0x13, 0x76, 0xFC, 0x0F,	/* '7' 55 */
+	0x06, 0x02, 0x09, 0x7D, 0xC7, 0xF4, 0x1D, 0xD3, 0x07,	/* '8' 56 */
+	0x06, 0x02, 0x09, 0x7D, 0xC7, 0xC1, 0xFA, 0x8F, 0xE9, 0x03,	/* '9' 57 */
+	0x41, 0x03, 0x06, 0x17, 0x07,	/* ':' 58 */
+	0x32, 0x01, 0x08, 0xD7, 0x84, 0x06,	/* ';' 59 */
+	0x05, 0x02, 0x09, 0xE1, 0x58, 0xA6, 0x71, 0x68, 0x64, 0x62, 0x61,	/* '<' 60 */
+	0x06, 0x05, 0x03, 0xFF, 0x01, 0xFF,	/* '=' 61 */
+	0x15, 0x02, 0x09, 0x87, 0x46, 0x26, 0x16, 0x8E, 0x65, 0x1A, 0x07,	/* '>' 62 */
+	0x06, 0x02, 0x09, 0x31, 0x02, 0x62, 0x84, 0x1D, 0xEB, 0x03,	/* '?' 63 */
+	0x06, 0x02, 0x09, 0xFD, 0x07, 0x77, 0xF7, 0x1C, 0xEB, 0x03,	/* '@' 64 */
+	0x06, 0x02, 0x09, 0xC7, 0xFC, 0x1F, 0xD3, 0x96, 0x03,	/* 'A' 65 */
+	0x06, 0x02, 0x09, 0x7F, 0xCD, 0xF4, 0x35, 0xF3, 0x07,	/* 'B' 66 */
+	0x06, 0x02, 0x09, 0x79, 0xCD, 0x07, 0xD0, 0x9C, 0x07,	/* 'C' 67 */
+	0x06, 0x02, 0x09, 0x3F, 0x6D, 0xCD, 0xD0, 0xF6, 0x03,	/* 'D' 68 */
+	0x06, 0x02, 0x09, 0xFF, 0xCD, 0x0D, 0xFA, 0x1A, 0x34, 0xFF, 0x03,	/* 'E' 69 */
+	0x06, 0x02, 0x09, 0x1F, 0x0D, 0xF4, 0x35, 0x68, 0xFE, 0x07,	/* 'F' 70 */
+	0x06, 0x02, 0x09, 0x7D, 0xC7, 0xCE, 0x0F, 0x1C, 0xEB, 0x03,	/* 'G' 71 */
+	0x06, 0x02, 0x09, 0xC7, 0xF8, 0x3F, 0x06,	/* 'H' 72 */
+	0x23, 0x02, 0x09, 0xBF, 0x01, 0x1F,	/* 'I' 73 */
+	0x05, 0x02, 0x09, 0x9D, 0x9B, 0x18, 0xE4, 0x01,	/* 'J' 74 */
+	0x06, 0x02, 0x09, 0xC7, 0xCE, 0x6E, 0x3E, 0xDC, 0x9C, 0x1D, 0x03,	/* 'K' 75 */
+	0x06, 0x02, 0x09, 0xFF, 0xCD, 0x8D, 0x0D, 0xF0, 0x01,	/* 'L' 76 */
+	0x06, 0x02, 0x09, 0xC7, 0xAE, 0xF9, 0x7F, 0x3F, 0x06,	/* 'M' 77 */
+	0x06, 0x02, 0x09, 0xC7, 0xE7, 0xEE, 0xBF, 0x9F, 0x1D, 0x03,	/* 'N' 78 */
+	0x06, 0x02, 0x09, 0x7D, 0xC7, 0x40, 0x1F,	/* 'O' 79 */
+	0x06, 0x02, 0x09, 0x1F, 0x0D, 0xF4, 0x35, 0xF3, 0x07,	/* 'P' 80 */
+	0x06, 0x01, 0x0A, 0xC1, 0x7D, 0xD7, 0xC7, 0xA0, 0x0F,	/* 'Q' 81 */
+	0x06, 0x02, 0x09, 0xCF, 0xCD, 0x6D, 0x3D, 0x7D, 0xCD, 0xFC, 0x01,	/* 'R' 82 */
+	0x06, 0x02, 0x09, 0x7D, 0xC7, 0xC1, 0x61, 0x39, 0x0D, 0x07, 0xC7, 0x7D,	/* 'S' 83 */
+	0x15, 0x02, 0x09, 0xBD, 0x0C, 0xD8, 0xFE, 0x01,	/* 'T' 84 */
+	0x06, 0x02, 0x09, 0x7D, 0xC7, 0x00,	/* 'U' 85 */
+	0x06, 0x02, 0x09, 0x11, 0x39, 0x6D, 0xC7, 0x00,	/* 'V' 86 */
+	0x06, 0x02, 0x09, 0xC7, 0xDE, 0xFF, 0xAF, 0x39, 0x06,	/* 'W' 87 */
+	0x06, 0x02, 0x09, 0xC7, 0xDA, 0x72, 0x68, 0x3B, 0x06,	/* 'X' 88 */
+	0x15, 0x02, 0x09, 0xBD, 0x0C, 0xBD, 0x33, 0x00,	/* 'Y' 89 */
+	0x06, 0x02, 0x09, 0xFF, 0xC7, 0x87, 0x0D, 0x19, 0x31, 0x63, 0xC7, 0xFF,	/* 'Z' 90 */
+	0x14, 0x02, 0x09, 0xFF, 0x01, 0xFC,	/* '[' 91 */
+	0x06, 0x02, 0x08, 0x81, 0xC1, 0x61, 0x31, 0x19, 0x0D, 0x07, 0x03,	/* '\' 92 */
+	0x14, 0x02, 0x09, 0x7F, 0x0C, 0xFC,	/* ']' 93 */
+	0x06, 0x08, 0x04, 0xC7, 0x6D, 0x39, 0x11,	/* '^' 94 */
+	0x07, 0x00, 0x01, 0xFF, 0x01,	/* '_' 95 */
+	0x32, 0x08, 0x04, 0x7D, 0x00,	/* '`' 96 */
+	0x06, 0x02, 0x06, 0xDD, 0x77, 0x67, 0x7D, 0x61, 0x3D,	/* 'a' 97 */
+	0x06, 0x02, 0x09, 0x7F, 0xCD, 0xE8, 0x6B, 0xF0, 0x00,	/* 'b' 98 */
+	0x06, 0x02, 0x06, 0x7D, 0xC7, 0x07, 0x8E, 0xFB, 0x00,	/* 'c' 99 */
+	0x06, 0x02, 0x09, 0xFD, 0x67, 0xE8, 0x0B, 0x13, 0x07,	/* 'd' 100 */
+	0x06, 0x02, 0x06, 0x7D, 0xC7, 0x07, 0xFF, 0xC7, 0x7D,	/* 'e' 101 */
+	0x06, 0x02, 0x09, 0x3D, 0x19, 0xFC, 0x65, 0xC8, 0x8E, 0x03,	/* 'f' 102 */
+	0x06, 0x00, 0x08, 0x7D, 0xC7, 0xC1, 0xFD, 0xC7, 0xCE, 0xBB, 0x01,	/* 'g' 103 */
+	0x06, 0x02, 0x09, 0xCF, 0xCD, 0x74, 0xB7, 0x35, 0x78, 0x00,	/* 'h' 104 */
+	0x23, 0x02, 0x09, 0xBF, 0xE1, 0x85, 0x06,	/* 'i' 105 */
+	0x05, 0x00, 0x0B, 0xBD, 0xB3, 0x30, 0xE2, 0x81, 0x30,	/* 'j' 106 */
+	0x06, 0x02, 0x09, 0xCF, 0xCD, 0x6D, 0x3D, 0x6D, 0xCD, 0x0D, 0x1E, 0x00,	/* 'k' 107 */
+	0x23, 0x02, 0x09, 0xBF, 0x01, 0x0F,	/* 'l' 108 */
+	0x06, 0x02, 0x06, 0xC7, 0xAE, 0xFD, 0xB7, 0x01,	/* 'm' 109 */
+	0x06, 0x02, 0x06, 0xCD, 0x70, 0x07,	/* 'n' 110 */
+	0x06, 0x02, 0x06, 0x7D, 0xC7, 0xE8, 0x03,	/* 'o' 111 */
+	0x06, 0x00, 0x08, 0x1F, 0x0D, 0xFA, 0x9A, 0xB9, 0x03,	/* 'p' 112 */
+	0x06, 0x00, 0x08, 0xF1, 0x61, 0xFA, 0xCE, 0xE8, 0x06,	/* 'q' 113 */
+	0x06, 0x02, 0x06, 0x1F, 0x0D, 0x34, 0xDF, 0x01,	/* 'r' 114 */
+	0x06, 0x02, 0x06, 0x7D, 0xC7, 0x71, 0x1D, 0xC7, 0x7D,	/* 's' 115 */
+	0x06, 0x02, 0x09, 0x71, 0xD9, 0x19, 0xFC, 0x65, 0x00,	/* 't' 116 */
+	0x06, 0x02, 0x06, 0xDD, 0x67, 0x00,	/* 'u' 117 */
+	0x06, 0x02, 0x06, 0x11, 0x39, 0x6D, 0xC7, 0x00,	/* 'v' 118 */
+	0x06, 0x02, 0x06, 0x6D, 0xFF, 0xD7, 0x8E, 0x01,	/* 'w' 119 */
+	0x06, 0x02, 0x06, 0xC7, 0x6D, 0x39, 0xDA, 0x8E, 0x01,	/* 'x' 120 */
+	0x06, 0x00, 0x08, 0x7D, 0xC7, 0xC1, 0xDD, 0xE7, 0xC7, 0x00,	/* 'y' 121 */
+	0x06, 0x02, 0x06, 0xFF, 0x8D, 0x19, 0x31, 0x63, 0xFF,	/* 'z' 122 */
+	0x15, 0x02, 0x09, 0xF1, 0x0C, 0x8F, 0x0C, 0x71,	/* '{' 123 */
+	0x31, 0x02, 0x09, 0x47, 0x0E,	/* '|' 124 */
+	0x15, 0x02, 0x09, 0x8F, 0x0C, 0xF1, 0x0C, 0x0F,	/* '}' 125 */
+	0x06, 0x09, 0x02, 0x77, 0xDD,	/* '~' 126 */
+	0x00, 0x00,	/* padding */
+};
+
+static const unsigned short Font_8p_bold_Packed_Index[] =
+{
+	0, 3, 10, 15, 24, 38, 48, 60, 65, 72, 79, 87, 93, 98, 102, 106,
+	117, 129, 137, 149, 160, 171, 181, 191, 200, 209, 219, 224, 230, 241, 247, 258,
+	268, 278, 287, 296, 305, 314, 325, 335, 345, 352, 358, 366, 377, 386, 395, 405,
+	412, 421, 430, 441, 453, 461, 467, 475, 484, 493, 501, 513, 519, 530, 536, 543,
+	548, 553, 562, 571, 580, 589, 598, 608, 619, 629, 636, 645, 657, 663, 671, 677,
+	684, 693, 702, 710, 719, 728, 734, 742, 750, 759, 769, 778, 786, 791, 799
+};
+
+/**
+  * @brief  Font_12p glyphs, 12x12 cell, packed to glyph bounds
+  */
+static const unsigned char Font_12p_Packed_Rows[] =
+{
+	0x00, 0x00, 0x00,	/* ' ' 32 */
+	0x20, 0x02, 0x09, 0x37, 0x00,	/* '!' 33 */
+	0x12, 0x08, 0x03, 0x0B,	/* '"' 34 */
+	0x16, 0x02, 0x09, 0x25, 0x92, 0xFE, 0x93, 0xFE, 0x93, 0x22, 0x01,	/* '#' 35 */
+	0x14, 0x01, 0x0B, 0x49, 0xB7, 0x4A, 0xBB, 0xC5, 0xDA, 0x25,	/* '$' 36 */
+	0x19, 0x02, 0x09, 0x09, 0x8B, 0xA4, 0x50, 0x36, 0x6D, 0x0A, 0x93, 0xD0, 0x10,	/* '%' 37 */
+	0x26, 0x02, 0x09, 0xDD, 0x63, 0xA6, 0x1A, 0x2A, 0x4A, 0x64, 0x00,	/* '&' 38 */
+	0x10, 0x08, 0x03, 0x03,	/* ''' 39 */
+	0x22, 0x00, 0x0B, 0x65, 0x40, 0x49,	/* '(' 40 */
+	0x12, 0x00, 0x0B, 0x25, 0x41, 0x19,	/* ')' 41 */
+	0x12, 0x07, 0x04, 0x5B, 0x5F,	/* '*' 42 */
+	0x16, 0x04, 0x05, 0x11, 0xFE, 0x23, 0x00,	/* '+' 43 */
+	0x11, 0x00, 0x03, 0x2B,	/* ',' 44 */
+	0x12, 0x05, 0x01, 0x0F,	/* '-' 45 */
+	0x20, 0x02, 0x01, 0x03,	/* '.' 46 */
+	0x12, 0x02, 0x09, 0xA3, 0x90, 0x00,	/* '/' 47 */
+	0x14, 0x02, 0x09, 0x49, 0x35, 0x42, 0x95, 0x00,	/* '0' 48 */
+	0x12, 0x02, 0x09, 0x09, 0xB6, 0x13,	/* '1' 49 */
+	0x14, 0x02, 0x09, 0xFF, 0x50, 0x24, 0x51, 0x38, 0x4E, 0x0D,	/* '2' 50 */
+	0x14, 0x02, 0x09, 0xCD, 0x34, 0x46, 0x49, 0x14, 0x4E, 0x0D,	/* '3' 51 */
+	0x14, 0x02, 0x09, 0x91, 0x7F, 0xAA, 0x64, 0x22,	/* '4' 52 */
+	0x14, 0x02, 0x09, 0xCD, 0x34, 0x86, 0xD3, 0x33, 0x14, 0x3D,	/* '5' 53 */
+	0x14, 0x02, 0x09, 0x49, 0x35, 0xBA, 0x96, 0xA1, 0xCC, 0x00,	/* '6' 54 */
+	0x14, 0x02, 0x09, 0x05, 0x09, 0x51, 0xF8, 0x03,	/* '7' 55 */
+	0x14, 0x02, 0x09, 0x49, 0x35, 0x56, 0x49, 0x35, 0x56, 0x09,	/* '8' 56 */
+	0x14, 0x02, 0x09, 0xCD, 0x14, 0xA6, 0xF5, 0xA8, 0x4A, 0x00,	/* '9' 57 */
+	0x20, 0x02, 0x07, 0x07, 0x03,	/* ':' 58 */
+	0x11, 0x00, 0x09, 0xAB, 0x40, 0x01,	/* ';' 59 */
+	0x14, 0x03, 0x07, 0x61, 0xD4, 0x0C, 0x4D, 0x14, 0x02,	/* '<' 60 */
+	0x14, 0x05, 0x04, 0x7F, 0xE0, 0x07,	/* '=' 61 */
+	0x14, 0x03, 0x07, 0x43, 0x91, 0x85, 0x59, 0x31, 0x00,	/* '>' 62 */
+	0x14, 0x02, 0x09, 0x49, 0x90, 0x88, 0xC2, 0xF1, 0xEC, 0x00,	/* '?' 63 */
+	0x19, 0x00, 0x0B, 0x09, 0x2A, 0xE0, 0xEC, 0x96, 0xB9, 0x48, 0x16, 0x5B, 0xD7, 0x04, 0xC5, 0x07,	/* '@' 64 */
+	0x16, 0x02, 0x09, 0x83, 0x8A, 0xFA, 0x8A, 0x52, 0x88, 0x00,	/* 'A' 65 */
+	0x24, 0x02, 0x09, 0xDF, 0xC8, 0x37, 0xF2, 0x01,	/* 'B' 66 */
+	0x25, 0x02, 0x09, 0xB9, 0xE2, 0x70, 0xC0, 0xB0, 0x98, 0x03,	/* 'C' 67 */
+	0x25, 0x02, 0x09, 0x9F, 0xD1, 0x10, 0x46, 0x1F,	/* 'D' 68 */
+	0x24, 0x02, 0x09, 0xFF, 0xC0, 0x3F, 0xF0, 0x03,	/* 'E' 69 */
+	0x24, 0x02, 0x09, 0x03, 0xBE, 0x81, 0x1F,	/* 'F' 70 */
+	0x25, 0x02, 0x09, 0xB9, 0xE2, 0xD0, 0x7C, 0x30, 0x2C, 0xE6, 0x00,	/* 'G' 71 */
+	0x25, 0x02, 0x09, 0x43, 0xFC, 0x87, 0x00,	/* 'H' 72 */
+	0x20, 0x02, 0x09, 0x03, 0x00,	/* 'I' 73 */
+	0x13, 0x02, 0x09, 0x6D, 0x8A, 0x00,	/* 'J' 74 */
+	0x24, 0x02, 0x09, 0xE3, 0x64, 0x79, 0x16, 0xD3, 0x08,	/* 'K' 75 */
+	0x24, 0x02, 0x09, 0xFF, 0x00, 0x00,	/* 'L' 76 */
+	0x26, 0x02, 0x09, 0x93, 0xAB, 0x38, 0x66, 0x10,	/* 'M' 77 */
+	0x25, 0x02, 0x09, 0xC3, 0xB1, 0xE9, 0xD2, 0xD1, 0x10,	/* 'N' 78 */
+	0x25, 0x02, 0x09, 0x99, 0xD2, 0x10, 0x4A, 0x19,	/* 'O' 79 */
+	0x24, 0x02, 0x09, 0x03, 0xBE, 0x91, 0x0F,	/* 'P' 80 */
+	0x25, 0x01, 0x0A, 0xC1, 0x6C, 0x6D, 0x08, 0xA5, 0x0C,	/* 'Q' 81 */
+	0x26, 0x02, 0x09, 0x83, 0x43, 0x23, 0x13, 0x3F, 0x43, 0xFC, 0x00,	/* 'R' 82 */
+	0x24, 0x02, 0x09, 0xDD, 0x28, 0xEC, 0x86, 0x51, 0x07,	/* 'S' 83 */
+	0x24, 0x02, 0x09, 0x09, 0xE0, 0x07,	/* 'T' 84 */
+	0x25, 0x02, 0x09, 0x99, 0xD2, 0x10, 0x00,	/* 'U' 85 */
+	0x16, 0x02, 0x09, 0x11, 0x29, 0x14, 0x31, 0x08,	/* 'V' 86 */
+	0x18, 0x02, 0x09, 0x89, 0x54, 0x05, 0x55, 0x4E, 0x39, 0x22,	/* 'W' 87 */
+	0x16, 0x02, 0x09, 0x83, 0x45, 0x29, 0x22, 0x52, 0x14, 0x0D, 0x02,	/* 'X' 88 */
+	0x16, 0x02, 0x09, 0x11, 0x90, 0x52, 0x64, 0x10,	/* 'Y' 89 */
+	0x15, 0x02, 0x09, 0xFF, 0x41, 0x21, 0x21, 0x12, 0x0A, 0xFE, 0x01,	/* 'Z' 90 */
+	0x21, 0x00, 0x0B, 0x03, 0x70,	/* '[' 91 */
+	0x12, 0x02, 0x09, 0xA9, 0x60, 0x00,	/* '\' 92 */
+	0x11, 0x00, 0x0B, 0x05, 0x70,	/* ']' 93 */
+	0x14, 0x06, 0x05, 0x63, 0x45, 0x02,	/* '^' 94 */
+	0x15, 0x00, 0x01, 0x7F,	/* '_' 95 */
+	0x11, 0x0A, 0x02, 0x1D,	/* '`' 96 */
+	0x14, 0x02, 0x07, 0xFD, 0xA8, 0x0F, 0xC7, 0x0E,	/* 'a' 97 */
+	0x14, 0x02, 0x09, 0xDB, 0x39, 0x72, 0x6E, 0x03,	/* 'b' 98 */
+	0x13, 0x02, 0x07, 0x6D, 0x0E, 0x66, 0x03,	/* 'c' 99 */
+	0x14, 0x02, 0x09, 0xED, 0x3C, 0x32, 0xB7, 0x21,	/* 'd' 100 */
+	0x14, 0x02, 0x07, 0xDD, 0x38, 0xFC, 0xA3, 0x0E,	/* 'e' 101 */
+	0x02, 0x02, 0x09, 0x05, 0xBE, 0x1A,	/* 'f' 102 */
+	0x14, 0x00, 0x09, 0x63, 0xD8, 0xCE, 0x23, 0x73, 0x0B,	/* 'g' 103 */
+	0x14, 0x02, 0x09, 0x23, 0x9C, 0xDB, 0x00,	/* 'h' 104 */
+	0x10, 0x02, 0x09, 0x03, 0x0D,	/* 'i' 105 */
+	0x10, 0x00, 0x0B, 0x03, 0x34,	/* 'j' 106 */
+	0x13, 0x02, 0x09, 0xD3, 0x72, 0xD6, 0x1C, 0x00,	/* 'k' 107 */
+	0x10, 0x02, 0x09, 0x03, 0x00,	/* 'l' 108 */
+	0x16, 0x02, 0x07, 0x93, 0x70, 0xBB, 0x04,	/* 'm' 109 */
+	0x14, 0x02, 0x07, 0x23, 0x9C, 0x1B,	/* 'n' 110 */
+	0x14, 0x02, 0x07, 0xDD, 0x08, 0x1D,	/* 'o' 111 */
+	0x14, 0x00, 0x09, 0x83, 0xED, 0x1C, 0x39, 0x37,	/* 'p' 112 */
+	0x14, 0x00, 0x09, 0xA1, 0x76, 0x1E, 0x99, 0x5B,	/* 'q' 113 */
+	0x12, 0x02, 0x07, 0x03, 0xB7,	/* 'r' 114 */
+	0x13, 0x02, 0x07, 0x6D, 0xC6, 0x36, 0x66, 0x03,	/* 's' 115 */
+	0x02, 0x02, 0x09, 0x5D, 0xF0, 0x05,	/* 't' 116 */
+	0x14, 0x02, 0x07, 0xED, 0x3C, 0x02,	/* 'u' 117 */
+	0x14, 0x02, 0x07, 0x49, 0x85, 0x11,	/* 'v' 118 */
+	0x16, 0x02, 0x07, 0x45, 0xAB, 0x98, 0x04,	/* 'w' 119 */
+	0x14, 0x02, 0x07, 0x63, 0x25, 0xA9, 0x8C,	/* 'x' 120 */
+	0x14, 0x00, 0x09, 0x09, 0x2A, 0x46,	/* 'y' 121 */
+	0x13, 0x02, 0x07, 0x7F, 0x14, 0x29, 0x7E,	/* 'z' 122 */
+	0x12, 0x00, 0x0B, 0x05, 0x53, 0x48,	/* '{' 123 */
+	0x20, 0x00, 0x0B, 0x03, 0x00,	/* '|' 124 */
+	0x12, 0x00, 0x0B, 0x05, 0x59, 0x18,	/* '}' 125 */
+	0x14, 0x06, 0x02, 0xDB, 0x0B,	/* '~' 126 */
+	0x00, 0x00,	/* padding */
+};
+
+static const unsigned short Font_12p_Packed_Index[] =
+{
+	0, 3, 8, 12, 23, 33, 46, 57, 61, 67, 73, 78, 85, 89, 93, 97,
+	103, 111, 117, 127, 137, 145, 155, 165, 173, 183, 193, 198, 204, 213, 219, 228,
+	238, 254, 264, 272, 282, 290, 298, 305, 316, 323, 328, 334, 343, 349, 357, 366,
+	374, 381, 390, 401, 410, 416, 423, 431, 441, 452, 460, 471, 476, 482, 487, 493,
+	497, 501, 509, 517, 524, 532, 540, 546, 555, 562, 567, 572, 580, 585, 592, 598,
+	604, 612, 620, 625, 633, 639, 645, 651, 658, 665, 671, 678, 684, 689, 695
+};
+
+/**
+  * @brief  Font_16p glyphs, 16x24 cell, packed to glyph bounds
+  */
+static const unsigned char Font_16p_Packed_Rows[] =
+{
+	0x00, 0x00, 0x00,	/* ' ' 32 */
+	0x71, 0x06, 0x11, 0x17, 0x07, 0x00,	/* '!' 33 */
+	0x25, 0x10, 0x06, 0x67, 0x00,	/* '"' 34 */
+	0x1B, 0x01, 0x11, 0x8D, 0x81, 0x8C, 0xE1, 0xFF, 0xCB, 0x18, 0x39, 0x27, 0xC6, 0xFC, 0x7F, 0x31, 0x46, 0x18, 0x03,	/* '#' 35 */
+	0x2A, 0x03, 0x14, 0x41, 0x20, 0x3E, 0xF2, 0xAF, 0xCB, 0x9E, 0xF8, 0x88, 0x05, 0x79, 0xD0, 0xC5, 0x4F, 0x3F, 0x34, 0xC1, 0x11, 0x1C, 0xF1, 0x91, 0x3F, 0x5D, 0xFF, 0xC5, 0x47, 0x10, 0x00,	/* '$' 36 */
+	0x0E, 0x03, 0x12, 0x19, 0x70, 0x31, 0xD8, 0x31, 0x88, 0x61, 0x88, 0x82, 0x11, 0x05, 0x66, 0x07, 0xC6, 0x75, 0x0C, 0xDC, 0x0C, 0x8C, 0x18, 0x18, 0x61, 0x30, 0x82, 0x71, 0x83, 0xD1, 0x01, 0x03,	/* '%' 37 */
+	0x1D, 0x06, 0x11, 0xF1, 0xA1, 0xFE, 0xF9, 0xC1, 0xEF, 0x80, 0xE3, 0xC0, 0xF3, 0x30, 0xEB, 0x8C, 0xE5, 0x03, 0xE2, 0x01, 0xF1, 0x81, 0x98, 0x41, 0x86, 0x41, 0xCE, 0x21, 0x7E, 0x10, 0x1E, 0x00,	/* '&' 38 */
+	0x21, 0x10, 0x06, 0x07,	/* ''' 39 */
+	0x45, 0x01, 0x16, 0xC1, 0x70, 0x2C, 0xA3, 0xE1, 0x00, 0x68, 0xC8, 0x88, 0x85, 0x83,	/* '(' 40 */
+	0x55, 0x01, 0x16, 0x83, 0x43, 0x23, 0x23, 0x26, 0x0C, 0x88, 0xC9, 0x68, 0x1C, 0x06,	/* ')' 41 */
+	0x37, 0x0B, 0x07, 0xCF, 0x9B, 0xE5, 0xF9, 0x7F, 0x3B, 0x06,	/* '*' 42 */
+	0x2B, 0x06, 0x0C, 0xC1, 0x00, 0xFE, 0xBF, 0x60, 0x00,	/* '+' 43 */
+	0x71, 0x02, 0x05, 0xAB, 0x03,	/* ',' 44 */
+	0x55, 0x0A, 0x02, 0x7F,	/* '-' 45 */
+	0x61, 0x05, 0x02, 0x07,	/* '.' 46 */
+	0x56, 0x06, 0x11, 0x07, 0x1A, 0xC8, 0x20, 0x27, 0x86, 0x30, 0x82, 0x01,	/* '/' 47 */
+	0x2A, 0x06, 0x11, 0xF1, 0x91, 0x3F, 0x1D, 0xD7, 0x60, 0x07, 0x0C, 0xD0, 0x60, 0x1D, 0x97, 0x3F, 0xF1, 0x01,	/* '0' 48 */
+	0x35, 0x06, 0x11, 0x61, 0x00, 0xC6, 0xE7, 0x7E, 0x3C, 0x1C, 0x04,	/* '1' 49 */
+	0x2A, 0x06, 0x11, 0xFF, 0xAF, 0x01, 0x32, 0x20, 0x06, 0xC2, 0x20, 0x18, 0x02, 0x23, 0x60, 0x02, 0x2C, 0x80, 0x1D, 0xB0, 0x06, 0xEB, 0xBF, 0xF8, 0x00,	/* '2' 50 */
+	0x2A, 0x06, 0x11, 0xF1, 0xD1, 0x3F, 0x0D, 0x76, 0xC0, 0x02, 0x58, 0x80, 0x85, 0x4F, 0x78, 0x04, 0x4C, 0x80, 0x1D, 0x98, 0x86, 0xEB, 0x9F, 0x78, 0x00,	/* '3' 51 */
+	0x2B, 0x06, 0x11, 0x01, 0x06, 0xFF, 0xDF, 0x81, 0x69, 0x30, 0x19, 0x26, 0xC6, 0x08, 0x33, 0xC1, 0x26, 0xF0, 0x08, 0x38, 0x01, 0x06,	/* '4' 52 */
+	0x2A, 0x06, 0x11, 0xF1, 0xD1, 0x3F, 0x0D, 0xF7, 0x60, 0x07, 0x1C, 0xC0, 0x04, 0xF8, 0xC3, 0xFD, 0xCF, 0x7D, 0x1C, 0x40, 0x03, 0xE8, 0x3F,	/* '5' 53 */
+	0x2A, 0x06, 0x11, 0xF1, 0x91, 0x3F, 0x1D, 0xD7, 0xE0, 0x07, 0xCC, 0x83, 0x7F, 0xDC, 0xFD, 0x9D, 0xC7, 0x01, 0x34, 0x40, 0x03, 0x77, 0x78, 0xFE, 0x85, 0x0F,	/* '6' 54 */
+	0x2A, 0x06, 0x11, 0x19, 0x40, 0x0E, 0xC4, 0x80, 0x38, 0x08, 0x83, 0x70, 0x08, 0x86, 0xE0, 0x08, 0x8C, 0x80, 0x11, 0x60, 0xFF, 0x0F,	/* '7' 55 */
+	0x2A, 0x06, 0x11, 0xF1, 0xD1, 0x7F, 0x1D, 0x76, 0xC0, 0x68, 0xB0, 0xFC, 0xD1, 0x31, 0x0D, 0x46, 0xC7, 0xE5, 0x4F, 0x7C, 0x00,	/* '8' 56 */
+	0x2A, 0x06, 0x11, 0xF9, 0xD0, 0x3F, 0x0F, 0x17, 0x60, 0x02, 0x38, 0x9E, 0xFB, 0xBB, 0xE3, 0x1F, 0xFC, 0x80, 0x79, 0xB0, 0x8E, 0xCB, 0x9F, 0xF8, 0x00,	/* '9' 57 */
+	0x71, 0x06, 0x0C, 0x17, 0xC0, 0x01,	/* ':' 58 */
+	0x71, 0x03, 0x0F, 0xAB, 0x0B, 0xE0, 0x00,	/* ';' 59 */
+	0x39, 0x05, 0x0B, 0x01, 0x0C, 0x78, 0xF8, 0xF2, 0xF1, 0x83, 0x03, 0xFC, 0x20, 0x1F, 0xE1, 0x0B, 0x78, 0x00, 0x01,	/* '<' 60 */
+	0x39, 0x0B, 0x05, 0xFF, 0x0F, 0x00, 0xFF, 0x07,	/* '=' 61 */
+	0x39, 0x05, 0x0B, 0x03, 0x78, 0x40, 0x1F, 0xE2, 0x13, 0xFC, 0x00, 0x07, 0x3F, 0x3E, 0x7D, 0x78, 0xC0, 0x00, 0x00,	/* '>' 62 */
+	0x2A, 0x06, 0x11, 0x61, 0x20, 0x00, 0x84, 0x01, 0xC1, 0x10, 0x18, 0x01, 0x13, 0x60, 0x01, 0x7C, 0xC0, 0x1A, 0xAC, 0xFF, 0xE2, 0x03,	/* '?' 63 */
+	0x0E, 0x06, 0x10, 0xC1, 0x0F, 0x31, 0x30, 0x09, 0x40, 0x05, 0x80, 0xC5, 0x19, 0x23, 0x26, 0x13, 0x44, 0x13, 0x88, 0x8C, 0x20, 0x16, 0x51, 0x16, 0x4E, 0x25, 0x00, 0xC5, 0xC0, 0x04, 0x3F, 0x00,	/* '@' 64 */
+	0x1E, 0x06, 0x11, 0x07, 0xC0, 0x1A, 0xC0, 0x74, 0xC0, 0xE5, 0xFF, 0x88, 0xC1, 0x20, 0x8C, 0x41, 0xB0, 0x01, 0x81, 0x03, 0x00,	/* 'A' 65 */
+	0x2B, 0x06, 0x11, 0xFF, 0xE3, 0xFF, 0x1D, 0xB0, 0x03, 0x8C, 0x03, 0xF6, 0x7F, 0xFE, 0xC7, 0x81, 0x39, 0x60, 0x1C, 0x98, 0xFF, 0xF3, 0x1F, 0x00,	/* 'B' 66 */
+	0x1D, 0x06, 0x11, 0xE1, 0x87, 0xF8, 0x4F, 0x07, 0xAC, 0x01, 0x7E, 0x00, 0x3E, 0x00, 0x80, 0x03, 0x70, 0x03, 0xBC, 0x03, 0x96, 0x83, 0x8B, 0xFF, 0x04, 0x1F, 0x00,	/* 'C' 67 */
+	0x1C, 0x06, 0x11, 0xFF, 0xC3, 0xFF, 0x73, 0xE0, 0x1C, 0x60, 0x0E, 0x60, 0xE0, 0x00, 0x73, 0xE0, 0xFC, 0x3F, 0xFF, 0x03,	/* 'D' 68 */
+	0x2B, 0x06, 0x11, 0xFF, 0xDF, 0x01, 0x00, 0xFF, 0xCF, 0x01, 0x80, 0xFF, 0x0F,	/* 'E' 69 */
+	0x3A, 0x06, 0x11, 0x07, 0x00, 0xF8, 0x3F, 0x07, 0x00, 0xFF, 0x0F,	/* 'F' 70 */
+	0x0F, 0x06, 0x11, 0xC1, 0x1F, 0xE2, 0xFF, 0xE4, 0x81, 0xEF, 0x00, 0xDC, 0x00, 0xF8, 0x01, 0xF0, 0x01, 0xE0, 0x03, 0xFE, 0x0E, 0x00, 0x78, 0x00, 0xDC, 0x00, 0xBC, 0x03, 0x58, 0x1E, 0xBC, 0xF8, 0x3F, 0xC1, 0x1F, 0x00,	/* 'G' 71 */
+	0x2B, 0x06, 0x11, 0x07, 0x18, 0xF0, 0xFF, 0x1D, 0x60, 0x00,	/* 'H' 72 */
+	0x71, 0x06, 0x11, 0x07, 0x00, 0x00,	/* 'I' 73 */
+	0x37, 0x06, 0x11, 0x79, 0xFA, 0x3D, 0x3F, 0x2C, 0x30, 0x00, 0x00,	/* 'J' 74 */
+	0x1D, 0x06, 0x11, 0x07, 0xE0, 0x03, 0xD8, 0x01, 0xE6, 0x80, 0x71, 0x60, 0x38, 0x18, 0x3C, 0x06, 0xBE, 0x01, 0x77, 0x80, 0x33, 0xC0, 0x31, 0xE0, 0x30, 0x70, 0x30, 0x38, 0x30, 0x1C, 0x30, 0x0E, 0x30, 0x07, 0x30,	/* 'K' 75 */
+	0x39, 0x06, 0x11, 0xFF, 0x77, 0x00, 0x00, 0x00,	/* 'L' 76 */
+	0x1E, 0x06, 0x11, 0x87, 0xC3, 0x8E, 0x8D, 0x71, 0xC6, 0xCC, 0x0D, 0x36, 0x3E, 0xE0, 0x79, 0x00, 0x07,	/* 'M' 77 */
+	0x2B, 0x06, 0x11, 0x07, 0xF8, 0x80, 0x1F, 0x78, 0x07, 0xDB, 0x61, 0x76, 0x8C, 0xCF, 0xB0, 0x1B, 0xEC, 0x03, 0x7B, 0xC0, 0x07, 0x18,	/* 'N' 78 */
+	0x0F, 0x06, 0x11, 0xC1, 0x0F, 0xE2, 0x7F, 0xE4, 0xC0, 0xE9, 0x00, 0xD7, 0x00, 0xEC, 0x00, 0x30, 0xD0, 0x00, 0xAC, 0x03, 0x5C, 0x0E, 0x9C, 0xF8, 0x1F, 0xC1, 0x0F, 0x00,	/* 'O' 79 */
+	0x2B, 0x06, 0x11, 0x07, 0x00, 0xF8, 0x1F, 0xFF, 0xEF, 0x80, 0x1D, 0x60, 0x1C, 0xF0, 0xFF, 0xF7, 0x7F, 0x00,	/* 'P' 80 */
+	0x0F, 0x05, 0x12, 0x01, 0x80, 0x83, 0xDF, 0xC7, 0xFF, 0xC9, 0xC1, 0xD3, 0xE1, 0xA7, 0xC1, 0xD8, 0x03, 0xF0, 0x03, 0xC0, 0x70, 0x00, 0xBC, 0x01, 0x58, 0x07, 0xB8, 0x1C, 0x38, 0xF1, 0x3F, 0x82, 0x1F, 0x00,	/* 'Q' 81 */
+	0x1D, 0x06, 0x11, 0x07, 0xE0, 0x03, 0x98, 0x03, 0x8C, 0x03, 0xC6, 0x81, 0xE1, 0x60, 0xF0, 0x7F, 0xF8, 0xFF, 0x1C, 0xE0, 0x0E, 0x60, 0x1C, 0xE0, 0xFE, 0x3F, 0xFF, 0x0F,	/* 'R' 82 */
+	0x1C, 0x06, 0x11, 0xE1, 0x47, 0xFE, 0xD3, 0xC1, 0x3D, 0xC0, 0x07, 0xB0, 0x00, 0x3C, 0xC0, 0x0B, 0x7F, 0xF2, 0x87, 0x0E, 0xA0, 0x01, 0x68, 0xC0, 0x74, 0x30, 0xF9, 0x4F, 0xF8, 0x00,	/* 'S' 83 */
+	0x1D, 0x06, 0x11, 0x81, 0x01, 0x00, 0xE0, 0xFF, 0x0F,	/* 'T' 84 */
+	0x2B, 0x06, 0x11, 0xF1, 0xA3, 0xFF, 0x35, 0xB0, 0x03, 0x0C, 0x00, 0x00,	/* 'U' 85 */
+	0x0E, 0x06, 0x11, 0x81, 0x03, 0x82, 0x0D, 0x84, 0x3B, 0x84, 0x31, 0x88, 0xE3, 0x88, 0xC1, 0x90, 0x01, 0x43, 0x03, 0x18, 0x07, 0xC0,	/* 'V' 86 */
+	0x0E, 0x06, 0x11, 0x71, 0x1C, 0xF2, 0x78, 0xB2, 0x68, 0xB2, 0x6D, 0x68, 0x36, 0x03, 0x87, 0xC3, 0x1C, 0x00, 0x03,	/* 'W' 87 */
+	0x0F, 0x06, 0x11, 0x0F, 0xC0, 0x3B, 0x80, 0x65, 0x80, 0x89, 0x81, 0x11, 0x86, 0x23, 0x1C, 0x43, 0x70, 0x83, 0xC0, 0x03, 0x01, 0x07, 0x04, 0x3E, 0x08, 0xE6, 0x10, 0x8E, 0x21, 0x0C, 0x46, 0x0C, 0x98, 0x0C, 0x70, 0x1F, 0xC0, 0x01,	/* 'X' 88 */
+	0x0F, 0x06, 0x11, 0x01, 0x03, 0x00, 0x81, 0x07, 0x82, 0x1F, 0x04, 0x33, 0x08, 0xC3, 0x10, 0x07, 0x23, 0x07, 0x4E, 0x06, 0x98, 0x06, 0x60, 0x07, 0x80, 0x01,	/* 'Y' 89 */
+	0x1D, 0x06, 0x11, 0xFF, 0x7F, 0x07, 0x80, 0x06, 0x40, 0x06, 0x20, 0x06, 0x10, 0x06, 0x08, 0x06, 0x04, 0x06, 0x02, 0x06, 0x01, 0x86, 0x00, 0x46, 0x00, 0x26, 0x00, 0x16, 0x00, 0xEE, 0xFF, 0x03,	/* 'Z' 90 */
+	0x54, 0x01, 0x16, 0xBF, 0x03, 0x00, 0xC0, 0x0F,	/* '[' 91 */
+	0x46, 0x06, 0x11, 0xC1, 0xC2, 0x88, 0x21, 0x27, 0x83, 0x06, 0x0E, 0x00,	/* '\' 92 */
+	0x54, 0x01, 0x16, 0xBF, 0x18, 0x00, 0xC0, 0x0F,	/* ']' 93 */
+	0x38, 0x0D, 0x09, 0x07, 0x6B, 0x4C, 0x36, 0xC4, 0x01,	/* '^' 94 */
+	0x0F, 0x05, 0x02, 0xFF, 0xFF, 0x01,	/* '_' 95 */
+	0x21, 0x11, 0x06, 0x07,	/* '`' 96 */
+	0x2A, 0x06, 0x0C, 0x79, 0xDC, 0x7F, 0x8F, 0x77, 0x60, 0xFA, 0x2C, 0xFF, 0x02, 0xEF, 0xC0, 0x1E, 0xAC, 0x7F, 0xF2, 0x03,	/* 'a' 97 */
+	0x39, 0x06, 0x11, 0xF7, 0xF8, 0xDF, 0xC3, 0x0E, 0x0C, 0x1E, 0xF6, 0xBF, 0x7B, 0x1C, 0x00, 0x00,	/* 'b' 98 */
+	0x38, 0x06, 0x0C, 0xF1, 0xF4, 0xD7, 0xF8, 0xC1, 0x07, 0xE0, 0xE0, 0xC6, 0xFB, 0x8B, 0x07,	/* 'c' 99 */
+	0x39, 0x06, 0x11, 0xF1, 0xEE, 0x7F, 0xC3, 0x0F, 0x0C, 0x1A, 0xDE, 0xFF, 0x78, 0x07, 0x18, 0x00,	/* 'd' 100 */
+	0x39, 0x06, 0x0C, 0xF1, 0xE9, 0x5F, 0xC3, 0x1F, 0x7C, 0x00, 0xFF, 0x77, 0xE0, 0x86, 0xF5, 0x2F, 0x1E,	/* 'e' 101 */
+	0x47, 0x06, 0x11, 0x19, 0x00, 0xFC, 0x93, 0x81, 0xFC, 0xF1, 0x01,	/* 'f' 102 */
+	0x29, 0x01, 0x11, 0xF9, 0xE8, 0xDF, 0xC3, 0x0E, 0x1C, 0xE0, 0x78, 0xF7, 0xBF, 0xE1, 0x07, 0x06, 0x0D, 0xEF, 0x7F, 0xBC, 0x01,	/* 'g' 103 */
+	0x39, 0x06, 0x11, 0x07, 0x06, 0x78, 0xF8, 0xFF, 0xEE, 0x73, 0x00, 0x00,	/* 'h' 104 */
+	0x61, 0x06, 0x11, 0x07, 0x40, 0x38,	/* 'i' 105 */
+	0x34, 0x01, 0x16, 0xDF, 0x1F, 0x03, 0x00, 0x01, 0x31,	/* 'j' 106 */
+	0x29, 0x06, 0x11, 0x07, 0x3E, 0xD8, 0x61, 0x8E, 0xF3, 0x8C, 0x3F, 0xDC, 0xE0, 0x0C, 0xC7, 0x38, 0xCC, 0xC1, 0x0E, 0x7C, 0x00, 0x00,	/* 'k' 107 */
+	0x61, 0x06, 0x11, 0x07, 0x00, 0x00,	/* 'l' 108 */
+	0x0F, 0x06, 0x0C, 0x07, 0x83, 0x01, 0x1E, 0x8F, 0xFF, 0xF7, 0xCB, 0xC7, 0x03,	/* 'm' 109 */
+	0x39, 0x06, 0x0C, 0x07, 0x06, 0x78, 0xF8, 0xFF, 0xCE, 0x03,	/* 'n' 110 */
+	0x39, 0x06, 0x0C, 0xF1, 0xE8, 0x5F, 0xC3, 0x0E, 0x0C, 0x1A, 0xD6, 0xBF, 0x78, 0x00,	/* 'o' 111 */
+	0x39, 0x01, 0x11, 0x07, 0x80, 0x7B, 0xFC, 0xEF, 0x61, 0x07, 0x06, 0x0F, 0xFB, 0xDF, 0x3D, 0x00,	/* 'p' 112 */
+	0x39, 0x01, 0x11, 0x01, 0x86, 0x78, 0xF7, 0xBF, 0xE1, 0x07, 0x06, 0x0D, 0xEF, 0x7F, 0xBC, 0x01,	/* 'q' 113 */
+	0x46, 0x06, 0x0C, 0x07, 0x00, 0x0F, 0x7F, 0xF7,	/* 'r' 114 */
+	0x38, 0x06, 0x0C, 0xF9, 0xF4, 0xF7, 0xF8, 0xC1, 0x01, 0xC7, 0xD7, 0xCF, 0x03, 0x07, 0x3F, 0xDE, 0x4F, 0x3E,	/* 's' 115 */
+	0x46, 0x06, 0x10, 0xF1, 0xF9, 0x19, 0x80, 0x7F, 0x19, 0x44, 0x00,	/* 't' 116 */
+	0x39, 0x06, 0x0C, 0x79, 0xEE, 0xFF, 0xC3, 0x0F, 0x0C, 0x00,	/* 'u' 117 */
+	0x2A, 0x06, 0x0C, 0xE1, 0x20, 0x36, 0xC8, 0x18, 0x1A, 0x8C, 0x03, 0x06,	/* 'v' 118 */
+	0x0E, 0x06, 0x0C, 0x39, 0x38, 0xB4, 0xB1, 0x71, 0x6C, 0xCC, 0xE1, 0xF0, 0xE0, 0x20,	/* 'w' 119 */
+	0x2B, 0x06, 0x0C, 0x0F, 0xBC, 0xC3, 0x65, 0x98, 0x98, 0x11, 0x1B, 0x10, 0x33, 0x32, 0x4C, 0x87, 0x7B, 0xE0,	/* 'x' 120 */
+	0x3A, 0x01, 0x11, 0x1D, 0xD0, 0x03, 0x71, 0x10, 0x06, 0xC2, 0x81, 0xD8, 0x90, 0x33, 0x19, 0xA3, 0xC3, 0x1A, 0xCC, 0x01, 0x03,	/* 'y' 121 */
+	0x2A, 0x06, 0x0C, 0xFF, 0xAF, 0x01, 0x32, 0x20, 0x06, 0xC2, 0x20, 0x18, 0x02, 0x23, 0x60, 0x02, 0xEC, 0xFF, 0x01,	/* 'z' 122 */
+	0x45, 0x02, 0x15, 0xE1, 0x58, 0x06, 0x24, 0x1A, 0x87, 0x86, 0x0C, 0x88, 0x85, 0x01,	/* '{' 123 */
+	0x71, 0x01, 0x16, 0x07, 0x00, 0x00,	/* '|' 124 */
+	0x55, 0x02, 0x15, 0x87, 0x46, 0x06, 0x44, 0x62, 0xE1, 0x98, 0x0C, 0x74, 0x1A, 0x07,	/* '}' 125 */
+	0x39, 0x0D, 0x03, 0xC3, 0xFB, 0x7F, 0x0F, 0x01,	/* '~' 126 */
+	0x00, 0x00,	/* padding */
+};
+
+static const unsigned short Font_16p_Packed_Index[] =
+{
+	0, 3, 9, 14, 33, 64, 96, 128, 132, 146, 160, 170, 179, 184, 188, 192,
+	204, 222, 233, 258, 283, 305, 328, 354, 376, 397, 422, 428, 435, 454, 462, 481,
+	503, 535, 556, 580, 607, 627, 640, 651, 687, 697, 703, 714, 749, 757, 774, 796,
+	824, 842, 876, 904, 934, 943, 955, 977, 996, 1034, 1060, 1092, 1100, 1112, 1120, 1129,
+	1135, 1139, 1159, 1175, 1190, 1206, 1223, 1234, 1255, 1267, 1273, 1282, 1304, 1310, 1323, 1333,
+	1347, 1363, 1379, 1387, 1405, 1416, 1426, 1438, 1452, 1470, 1491, 1510, 1524, 1530, 1544
+};
+
+//! Font descriptors in FONT_SIZE_TYPE order
+static const FONT_TYPE Fonts_Table[] =
+{
+	{8, 12, 32, 126, FALSE, NULL, NULL, Font_8p_Packed_Rows, Font_8p_Packed_Index, NULL},	//8p
+	{8, 12, 32, 126, FALSE, NULL, NULL, Font_8p_bold_Packed_Rows, Font_8p_bold_Packed_Index, NULL},	//8p_bold
+	{12, 12, 32, 126, FALSE, NULL, NULL, Font_12p_Packed_Rows, Font_12p_Packed_Index, NULL},	//12p
+	{16, 24, 32, 126, FALSE, NULL, NULL, Font_16p_Packed_Rows, Font_16p_Packed_Index, NULL}	//16p
+};
@@ -0,0 +1,1079 @@
+/**
+ * @file FrameBuffer.c
+ *
+ * @brief RAM frame buffer used by GraphicDriver module when GRAPHIC_DRIVER_FRAMEBUFFER is enabled
+ *
+ * @details Every drawing function is a plain memory store into frame buffer. Nothing is sent
+ * to LCD until FrameBuffer_Flush. Every drawing function also records the rectangle it touched,
+ * and FrameBuffer_Flush transfers only those rectangles, each in one window and one burst.
+ * Pixels outside of the screen are dropped.
+ *
+ * Pixels are stored in target pixel format with its kernels, colors come converted already.
+ * Buffer storage is sized for GRAPHIC_DRIVER_MAX_WIDTH at GRAPHIC_DRIVER_FRAMEBUFFER_BPP, rows are packed
+ * with target screen width and format, so a narrower screen or smaller pixel format fits more rows. When they are fewer than screen height frame buffer holds
+ * only one horizontal band of the screen, placed with FrameBuffer_SetBand. Pixels outside of the band are dropped, but rows
+ * they hit are remembered so the caller can render those rows again band by band.
+ *
+ * Dirty rectangles are merged under a bus cost model: a rectangle costs FRAMEBUFFER_WINDOW_BYTES
+ * plus its pixel data bytes. With less than 8 bits per pixel dirty rectangles are widened to whole bytes. Two rectangles are merged into their bounding box when
+ * transferring the bounding box costs no more than transferring both separately. When the list
+ * is full the new rectangle is merged with the one that makes the cheapest bounding box.
+ *
+ * With FRAMEBUFFER_DIFF enabled and target driver keeping screen rows in RAM, every dirty rectangle
+ * row is compared with what was sent before, word by word, and only changed runs are sent. Runs closer
+ * than FRAMEBUFFER_DIFF_GAP_BYTES are sent as one, gap included, to save window setups.
+ *
+ * Frame buffer is transferred to target driver set with FrameBuffer_SetTarget, through its window
+ * stream or, without one, row by row through its WriteSpan entry. When target driver provides
+ * WritePixelsAsync FrameBuffer_FlushAsync only starts the transfer. Every dirty rectangle row,
+ * or whole rectangle when it spans full width, is one WritePixelsAsync burst and
+ * FrameBuffer_TransferComplete, called from DMA completion interrupt, starts the next one.
+ * With GRAPHIC_DRIVER_FRAMEBUFFER_COUNT set to 2 drawing switches to the other buffer right away,
+ * so the next frame is rendered while the previous one is transferred. With one buffer drawing
+ * waits until the transfer has finished.
+ *
+ * @author Krzysztof Grzeszczak
+ *
+ * @version 1.0
+ *
+ * @date 2012-2013
+ *
+ * @copyright GNU Public License
+ */
+
+#include "FrameBuffer.h"
+#include <stddef.h>
+#include <string.h>
+
+#if (GRAPHIC_DRIVER_FRAMEBUFFER != 0)
+
+//! FrameBuffer module driver descriptor
+const GRAPHIC_DRIVER_TYPE FrameBuffer_Driver =
+{
+	FrameBuffer_Initialize,
+	FrameBuffer_DrawPoint,
+	FrameBuffer_GetPoint,
+	FrameBuffer_ReadSpan,
+	NULL,						//GetRow, rows move between buffers
+	FrameBuffer_FillRect,
+	FrameBuffer_WriteSpan,
+	FrameBuffer_DrawMask,
+	FrameBuffer_BeginWindow,
+	FrameBuffer_PushPixels,
+	FrameBuffer_PushColor,
+	FrameBuffer_EndWindow,
+	NULL,						//WritePixelsAsync
+	NULL,						//Idle
+	FrameBuffer_Flush,
+	FrameBuffer_FlushAsync,
+	FrameBuffer_SetBand,
+	FrameBuffer_GetDamagedRows,
+	FrameBuffer_GetBandHeight,
+	NULL,						//SetRotation, target is already rotated
+	0,							//Width, same as target
+	0,							//Height
+	PIXEL_FORMAT_RGB565			//PixelFormat, same as target
+};
+
+static const GRAPHIC_DRIVER_TYPE *Target;			//!< Driver frame buffer is transferred to
+static bool IsTargetAsync;							//!< TRUE when Target streams windows with DMA
+static bool IsTargetDiff;							//!< TRUE when only changed runs are sent to Target
+static unsigned int Width;							//!< Target screen width, pixels in one buffer row
+static unsigned int Height;							//!< Target screen height
+static unsigned int Lines;							//!< Screen rows one buffer holds
+static unsigned int Stride;							//!< Bytes of one buffer row
+static unsigned int Align;							//!< Pixels per byte for packed formats, 1 otherwise
+static unsigned int Background;						//!< FRAMEBUFFER_BACKGROUND_COLOR in target format
+static const PIXEL_FORMAT_KERNELS_TYPE *Format;		//!< Kernels of target pixel format
+static FRAMEBUFFER_TYPE Buffers[GRAPHIC_DRIVER_FRAMEBUFFER_COUNT];	//!< Frame buffers, drawn and transferred in turn
+static FRAMEBUFFER_TYPE *Draw;						//!< Buffer that drawing goes into
+static FRAMEBUFFER_TYPE * volatile Transfer;		//!< Buffer being transferred to LCD, NULL when bus is idle
+static unsigned char TransferRect;					//!< Index of dirty rectangle being transferred
+static unsigned short TransferRow;					//!< Next row of that rectangle to transfer
+#if (FRAMEBUFFER_DIFF != 0)
+static unsigned int TransferByte;					//!< Next byte of that row to compare, diff mode
+#endif
+static GRAPHIC_DRIVER_CALLBACK_TYPE TransferDone;	//!< Called when transfer has finished
+static unsigned int DamageYStart;					//!< Top row drawn since last FrameBuffer_GetDamagedRows
+static unsigned int DamageYEnd;						//!< Row just below bottom row drawn since last FrameBuffer_GetDamagedRows
+static FRAMEBUFFER_FLUSH_STATS_TYPE FlushStats;		//!< Statistics of last flush
+static unsigned int WindowXStart;					//!< Leftmost column of current window
+static unsigned int WindowXEnd;						//!< Rightmost column of current window
+static unsigned int WindowYEnd;						//!< Bottom row of current window
+static unsigned int WindowX;						//!< Column of next pixel in current window
+static unsigned int WindowY;						//!< Row of next pixel in current window
+
+static void FrameBuffer_Reset(void);
+static unsigned char* FrameBuffer_GetRow(const FRAMEBUFFER_TYPE *buffer, unsigned int y);
+static void FrameBuffer_WaitDraw(void);
+static void FrameBuffer_Idle(void);
+static void FrameBuffer_StartRect(void);
+static void FrameBuffer_StartRow(void);
+static void FrameBuffer_EndTransfer(void);
+#if (FRAMEBUFFER_DIFF != 0)
+static void FrameBuffer_StartRuns(void);
+static void FrameBuffer_SetTransferRect(unsigned char index);
+static bool FrameBuffer_FindRun(unsigned int *x, unsigned int *count);
+static unsigned int FrameBuffer_SkipEqual(const unsigned char *a, const unsigned char *b, unsigned int start, unsigned int end);
+static unsigned int FrameBuffer_SkipChanged(const unsigned char *a, const unsigned char *b, unsigned int start, unsigned int end);
+#endif
+#if (GRAPHIC_DRIVER_FRAMEBUFFER_COUNT > 1)
+static void FrameBuffer_CopyRects(FRAMEBUFFER_TYPE *to, const FRAMEBUFFER_TYPE *from);
+#endif
+static void FrameBuffer_PushRun(const void *pixels, unsigned int color, unsigned int count);
+static void FrameBuffer_AddDirtyRect(unsigned int x, unsigned int y, unsigned int x_end, unsigned int y_end);
+static void FrameBuffer_AddDamage(unsigned int y, unsigned int y_end);
+static unsigned long FrameBuffer_GetRectCost(const FRAMEBUFFER_RECT_TYPE *rect);
+static FRAMEBUFFER_RECT_TYPE FrameBuffer_GetBoundingRect(const FRAMEBUFFER_RECT_TYPE *a, const FRAMEBUFFER_RECT_TYPE *b);
+
+/**
+ * @brief Set driver frame buffer is transferred to and take its resolution, frame buffers are cleared
+ *
+ * @param target - pointer to driver descriptor, has to provide SetWindow or WriteSpan, and resolution
+ */
+void FrameBuffer_SetTarget(const GRAPHIC_DRIVER_TYPE *target)
+{
+	FrameBuffer_WaitTransfer();
+	Target = target;
+	IsTargetAsync = ( (target->SetWindow != NULL) && (target->WritePixelsAsync != NULL) ) ? TRUE : FALSE;
+	IsTargetDiff = ( (FRAMEBUFFER_DIFF != 0) && (target->GetRow != NULL) ) ? TRUE : FALSE;
+
+	Format = PixelFormat_GetKernels(target->PixelFormat);
+	Align = (Format->BitsPerPixel < 8) ? 8 / Format->BitsPerPixel : 1;
+	Background = Format->FromRgb565(FRAMEBUFFER_BACKGROUND_COLOR);
+
+	Width = (target->Width < GRAPHIC_DRIVER_MAX_WIDTH) ? target->Width : GRAPHIC_DRIVER_MAX_WIDTH;
+	Height = target->Height;
+	Stride = PixelFormat_GetBytes(Format, Width);
+	Lines = sizeof(Buffers[0].Pixels) / Stride;
+	if(Lines > Height)
+	{
+		Lines = Height;
+	}
+
+	FrameBuffer_Reset();
+}
+
+/**
+ * @brief Initialize target driver, clear frame buffers and place them at the top of the screen
+ */
+void FrameBuffer_Initialize(void)
+{
+	FrameBuffer_WaitTransfer();
+	if(Target->Initialize != NULL)
+	{
+		Target->Initialize();
+	}
+	FrameBuffer_Reset();
+}
+
+/**
+ * @brief Get number of screen rows one frame buffer holds
+ */
+unsigned short FrameBuffer_GetBandHeight(void)
+{
+	return (unsigned short)Lines;
+}
+
+/**
+ * @brief Place frame buffer band at defined screen row
+ *
+ * @details Band is cleared with FRAMEBUFFER_BACKGROUND_COLOR and marked dirty as a whole, so the next
+ * flush transfers all of it. Band placed at screen height holds no rows: drawing only records damaged rows.
+ *
+ * @note Does nothing when frame buffer holds the whole screen
+ */
+void FrameBuffer_SetBand(unsigned short y)
+{
+	if(Lines >= Height)
+	{
+		return;
+	}
+
+	FrameBuffer_WaitDraw();
+
+	Draw->BandY = (y < Height) ? y : Height;
+	Draw->BandYEnd = Draw->BandY + Lines;
+	if(Draw->BandYEnd > Height)
+	{
+		Draw->BandYEnd = Height;
+	}
+
+	Draw->DirtyCount = 0;
+	FrameBuffer_FillRect(0, Draw->BandY, Width, Draw->BandYEnd - Draw->BandY, Background);
+}
+
+/**
+ * @brief Get screen rows drawn since last call, including rows outside of the band
+ *
+ * @param y_start - receives top damaged row
+ * @param y_end - receives row just below bottom damaged row
+ *
+ * @return TRUE if anything was drawn, FALSE otherwise
+ */
+bool FrameBuffer_GetDamagedRows(unsigned short *y_start, unsigned short *y_end)
+{
+	bool is_damaged = (DamageYStart < DamageYEnd) ? TRUE : FALSE;
+
+	*y_start = DamageYStart;
+	*y_end = DamageYEnd;
+	DamageYStart = Height;
+	DamageYEnd = 0;
+
+	return is_damaged;
+}
+
+/**
+ * @brief Store one pixel in frame buffer
+ */
+void FrameBuffer_DrawPoint(unsigned short x, unsigned short y, unsigned int color)
+{
+	FrameBuffer_AddDamage(y, y + 1);
+
+	if( (x < Width) && (y >= Draw->BandY) && (y < Draw->BandYEnd) )
+	{
+		FrameBuffer_WaitDraw();
+		Format->Fill(FrameBuffer_GetRow(Draw, y), x, 1, color);
+		FrameBuffer_AddDirtyRect(x, y, x + 1, y + 1);
+	}
+}
+
+/**
+ * @brief Get color data of one pixel from frame buffer, pixel outside of the band is read from target
+ */
+unsigned int FrameBuffer_GetPoint(unsigned short x, unsigned short y)
+{
+	if( (x < Width) && (y >= Draw->BandY) && (y < Draw->BandYEnd) )
+	{
+		return Format->Get(FrameBuffer_GetRow(Draw, y), x);
+	}
+	return Target->GetPoint(x, y);
+}
+
+/**
+ * @brief Read span of pixel data from frame buffer, row outside of the band is read from target
+ */
+void FrameBuffer_ReadSpan(unsigned short x, unsigned short y, unsigned short length, void *pixels)
+{
+	if( ((unsigned int)x + length <= Width) && (y >= Draw->BandY) && (y < Draw->BandYEnd) )
+	{
+		Format->Copy(pixels, 0, FrameBuffer_GetRow(Draw, y), x, length);
+		return;
+	}
+	Target->ReadSpan(x, y, length, pixels);
+}
+
+/**
+ * @brief Fill rectangle in frame buffer, part outside of the band is dropped
+ */
+void FrameBuffer_FillRect(unsigned short x, unsigned short y, unsigned short width, unsigned short height, unsigned int color)
+{
+	unsigned int x_end = (unsigned int)x + width;
+	unsigned int y_end = (unsigned int)y + height;
+	unsigned int y_start = y;
+	unsigned int row;
+
+	FrameBuffer_AddDamage(y_start, y_end);
+	FrameBuffer_WaitDraw();
+
+	if(x_end > Width)
+	{
+		x_end = Width;
+	}
+	if(y_start < Draw->BandY)
+	{
+		y_start = Draw->BandY;
+	}
+	if(y_end > Draw->BandYEnd)
+	{
+		y_end = Draw->BandYEnd;
+	}
+
+	if(x >= x_end)
+	{
+		return;
+	}
+
+	for(row = y_start; row < y_end; row++)
+	{
+		Format->Fill(FrameBuffer_GetRow(Draw, row), x, x_end - x, color);
+	}
+	FrameBuffer_AddDirtyRect(x, y_start, x_end, y_end);
+}
+
+/**
+ * @brief Open window in frame buffer, both ends inclusive
+ */
+void FrameBuffer_BeginWindow(unsigned short x_start, unsigned short y_start, unsigned short x_end, unsigned short y_end)
+{
+	WindowXStart = x_start;
+	WindowXEnd = x_end;
+	WindowYEnd = y_end;
+	WindowX = x_start;
+	WindowY = y_start;
+}
+
+/**
+ * @brief Store horizontal run of pixels
+ */
+void FrameBuffer_WriteSpan(unsigned short x, unsigned short y, unsigned short length, const void *pixels)
+{
+	FrameBuffer_BeginWindow(x, y, x + length - 1, y);
+	FrameBuffer_PushRun(pixels, 0, length);
+}
+
+/**
+ * @brief Store pixels of one row where mask bit is set, with glyph blit kernel
+ */
+void FrameBuffer_DrawMask(unsigned short x, unsigned short y, unsigned short width, unsigned long mask, unsigned int color)
+{
+	unsigned int x_end;
+	unsigned long bits;
+
+	FrameBuffer_AddDamage(y, y + 1);
+
+	if( (x >= Width) || (y < Draw->BandY) || (y >= Draw->BandYEnd) )
+	{
+		return;
+	}
+
+	//Only columns between first and last set bit are touched
+	if(width < 32)
+	{
+		mask &= (1UL << width) - 1;
+	}
+	for( ; (mask != 0) && ( (mask & 0x01) == 0 ); mask >>= 1)
+	{
+		x++;
+	}
+	for(width = 0, bits = mask; bits != 0; bits >>= 1)
+	{
+		width++;
+	}
+	x_end = ( (unsigned int)x + width < Width ) ? (unsigned int)x + width : Width;
+	if(x >= x_end)
+	{
+		return;
+	}
+
+	FrameBuffer_WaitDraw();
+	Format->Blit(FrameBuffer_GetRow(Draw, y), x, mask, x_end - x, color);
+	FrameBuffer_AddDirtyRect(x, y, x_end, y + 1);
+}
+
+/**
+ * @brief Store run of pixels into current window
+ */
+void FrameBuffer_PushPixels(const void *pixels, unsigned int count)
+{
+	FrameBuffer_PushRun(pixels, 0, count);
+}
+
+/**
+ * @brief Store the same color count times into current window
+ */
+void FrameBuffer_PushColor(unsigned int color, unsigned int count)
+{
+	FrameBuffer_PushRun(NULL, color, count);
+}
+
+/**
+ * @brief Close window, nothing to do for memory
+ */
+void FrameBuffer_EndWindow(void)
+{
+	//Window rows are written straight into memory, nothing is pending
+}
+
+/**
+ * @brief Transfer dirty rectangles of frame buffer to LCD and wait until transfer has finished
+ *
+ * @details Every dirty rectangle costs one window and one burst of pixel data.
+ * Nothing is transferred if frame buffer was not modified since last flush.
+ */
+void FrameBuffer_Flush(void)
+{
+	FrameBuffer_FlushAsync(NULL);
+	FrameBuffer_WaitTransfer();
+}
+
+/**
+ * @brief Start transfer of dirty rectangles of frame buffer to LCD
+ *
+ * @details Waits for previous transfer to finish first, LCD bus serves one transfer at a time.
+ * With two frame buffers dirty rectangles are copied into the other buffer, which then takes drawing,
+ * so both hold the same picture. Unless target driver provides WritePixelsAsync transfer is made before return.
+ *
+ * @param done - called when transfer has finished, from DMA completion interrupt context. May be NULL.
+ */
+void FrameBuffer_FlushAsync(GRAPHIC_DRIVER_CALLBACK_TYPE done)
+{
+	unsigned char i;
+
+	FrameBuffer_WaitTransfer();
+
+	FlushStats.Rects = Draw->DirtyCount;
+	FlushStats.Pixels = 0;
+	FlushStats.Bytes = 0;
+	FlushStats.Runs = 0;
+	FlushStats.Gaps = 0;
+	for(i = 0; i < Draw->DirtyCount; i++)
+	{
+		FlushStats.Pixels += (unsigned long)Draw->DirtyRects[i].Width * Draw->DirtyRects[i].Height;
+		FlushStats.Bytes += FrameBuffer_GetRectCost(&Draw->DirtyRects[i]);
+	}
+
+	TransferDone = done;
+	TransferRect = 0;
+	Transfer = Draw;
+
+#if (GRAPHIC_DRIVER_FRAMEBUFFER_COUNT > 1)
+	if(Draw->DirtyCount > 0)
+	{
+		Draw = (Draw == &Buffers[0]) ? &Buffers[1] : &Buffers[0];
+		FrameBuffer_CopyRects(Draw, Transfer);
+	}
+#endif
+
+#if (FRAMEBUFFER_DIFF != 0)
+	if(IsTargetDiff == TRUE)
+	{
+		//Statistics count what is actually sent
+		FlushStats.Rects = 0;
+		FlushStats.Pixels = 0;
+		FlushStats.Bytes = 0;
+		FrameBuffer_SetTransferRect(0);
+		FrameBuffer_StartRuns();
+		return;
+	}
+#endif
+
+	FrameBuffer_StartRect();
+}
+
+/**
+ * @brief Wait until transfer started by FrameBuffer_FlushAsync has finished
+ */
+void FrameBuffer_WaitTransfer(void)
+{
+	while(Transfer != NULL)
+	{
+		FrameBuffer_Idle();
+	}
+}
+
+/**
+ * @brief Continue transfer with next burst, called by target driver when previous burst has finished
+ */
+void FrameBuffer_TransferComplete(void)
+{
+	const FRAMEBUFFER_RECT_TYPE *rect;
+
+	if(Transfer == NULL)
+	{
+		return;
+	}
+
+#if (FRAMEBUFFER_DIFF != 0)
+	if(IsTargetDiff == TRUE)
+	{
+		if(Target->EndWindow != NULL)
+		{
+			Target->EndWindow();
+		}
+		FrameBuffer_StartRuns();
+		return;
+	}
+#endif
+
+	rect = &Transfer->DirtyRects[TransferRect];
+	if(TransferRow < rect->Y + rect->Height)
+	{
+		FrameBuffer_StartRow();
+		return;
+	}
+
+	if(Target->EndWindow != NULL)
+	{
+		Target->EndWindow();
+	}
+	TransferRect++;
+	FrameBuffer_StartRect();
+}
+
+/**
+ * @brief Get rectangles modified since last flush
+ *
+ * @param count - pointer to variable that receives number of rectangles
+ *
+ * @return pointer to array of dirty rectangles, valid until next drawing operation or flush
+ */
+const FRAMEBUFFER_RECT_TYPE* FrameBuffer_GetDirtyRects(unsigned char *count)
+{
+	*count = Draw->DirtyCount;
+	return Draw->DirtyRects;
+}
+
+/**
+ * @brief Get transfer statistics of last flush
+ *
+ * @details With FRAMEBUFFER_DIFF statistics are complete once the transfer has finished
+ *
+ * @return FRAMEBUFFER_FLUSH_STATS_TYPE copy of statistics
+ */
+FRAMEBUFFER_FLUSH_STATS_TYPE FrameBuffer_GetFlushStats(void)
+{
+	return FlushStats;
+}
+
+/**
+ * @brief Clear frame buffers and place them at the top of the screen
+ */
+void FrameBuffer_Reset(void)
+{
+	unsigned char i;
+
+	for(i = 0; i < GRAPHIC_DRIVER_FRAMEBUFFER_COUNT; i++)
+	{
+		Draw = &Buffers[i];
+		Draw->BandY = 0;
+		Draw->BandYEnd = Lines;
+		Draw->DirtyCount = 0;
+		FrameBuffer_FillRect(0, 0, Width, Draw->BandYEnd, Background);
+	}
+	Draw = &Buffers[0];
+	DamageYStart = Height;
+	DamageYEnd = 0;
+}
+
+/**
+ * @brief Get start of screen row y in buffer, row has to be inside of the band
+ */
+unsigned char* FrameBuffer_GetRow(const FRAMEBUFFER_TYPE *buffer, unsigned int y)
+{
+	return (unsigned char *)buffer->Pixels + (y - buffer->BandY) * Stride;
+}
+
+/**
+ * @brief Wait until buffer that drawing goes into is not being transferred
+ */
+void FrameBuffer_WaitDraw(void)
+{
+	while(Transfer == Draw)
+	{
+		FrameBuffer_Idle();
+	}
+}
+
+/**
+ * @brief Give CPU away while waiting for transfer, if target driver wants it
+ */
+void FrameBuffer_Idle(void)
+{
+	if(Target->Idle != NULL)
+	{
+		Target->Idle();
+	}
+}
+
+/**
+ * @brief Open target window of next dirty rectangle and start its first burst, or finish the transfer
+ *
+ * @details Unless target driver provides WritePixelsAsync all remaining rectangles are transferred before return.
+ */
+void FrameBuffer_StartRect(void)
+{
+	const FRAMEBUFFER_RECT_TYPE *rect;
+
+	for( ; TransferRect < Transfer->DirtyCount; TransferRect++)
+	{
+		rect = &Transfer->DirtyRects[TransferRect];
+		if(Target->SetWindow != NULL)
+		{
+			Target->SetWindow(rect->X, rect->Y, rect->X + rect->Width - 1, rect->Y + rect->Height - 1);
+		}
+		TransferRow = rect->Y;
+
+		if(IsTargetAsync == TRUE)
+		{
+			//FrameBuffer_TransferComplete goes on
+			FrameBuffer_StartRow();
+			return;
+		}
+
+		while(TransferRow < rect->Y + rect->Height)
+		{
+			FrameBuffer_StartRow();
+		}
+		if(Target->EndWindow != NULL)
+		{
+			Target->EndWindow();
+		}
+	}
+
+	FrameBuffer_EndTransfer();
+}
+
+/**
+ * @brief Send next row of current dirty rectangle, or the whole rectangle when it spans full width
+ */
+void FrameBuffer_StartRow(void)
+{
+	const FRAMEBUFFER_RECT_TYPE *rect = &Transfer->DirtyRects[TransferRect];
+	const unsigned char *pixels = FrameBuffer_GetRow(Transfer, TransferRow) + PixelFormat_GetBytes(Format, rect->X);
+	unsigned int count = rect->Width;
+
+	if(Target->SetWindow == NULL)
+	{
+		Target->WriteSpan(rect->X, TransferRow++, rect->Width, pixels);
+		return;
+	}
+
+	if( (rect->Width == Width) && ( (Width * Format->BitsPerPixel) % 8 == 0 ) )
+	{
+		//Full width rows are contiguous in memory
+		count = Width * rect->Height;
+		TransferRow = rect->Y + rect->Height;
+	}
+	else
+	{
+		TransferRow++;
+	}
+
+	if(IsTargetAsync == TRUE)
+	{
+		Target->WritePixelsAsync(pixels, count);
+	}
+	else
+	{
+		Target->WritePixels(pixels, count);
+	}
+}
+
+/**
+ * @brief Mark transferred buffer clean and report that the transfer has finished
+ */
+void FrameBuffer_EndTransfer(void)
+{
+	GRAPHIC_DRIVER_CALLBACK_TYPE done = TransferDone;
+
+	Transfer->DirtyCount = 0;
+	Transfer = NULL;
+	if(done != NULL)
+	{
+		done();
+	}
+}
+
+#if (FRAMEBUFFER_DIFF != 0)
+/**
+ * @brief Send changed runs of dirty rectangles one window each, or finish the transfer
+ *
+ * @details Unless target driver provides WritePixelsAsync all remaining runs are sent before return.
+ */
+void FrameBuffer_StartRuns(void)
+{
+	const unsigned char *pixels;
+	unsigned int x, count;
+
+	while(FrameBuffer_FindRun(&x, &count) == TRUE)
+	{
+		pixels = FrameBuffer_GetRow(Transfer, TransferRow) + PixelFormat_GetBytes(Format, x);
+		FlushStats.Rects++;
+		FlushStats.Runs++;
+		FlushStats.Pixels += count;
+		FlushStats.Bytes += FRAMEBUFFER_WINDOW_BYTES + PixelFormat_GetBytes(Format, count);
+
+		if(Target->SetWindow == NULL)
+		{
+			Target->WriteSpan(x, TransferRow, count, pixels);
+			continue;
+		}
+
+		Target->SetWindow(x, TransferRow, x + count - 1, TransferRow);
+		if(IsTargetAsync == TRUE)
+		{
+			//FrameBuffer_TransferComplete goes on
+			Target->WritePixelsAsync(pixels, count);
+			return;
+		}
+		Target->WritePixels(pixels, count);
+		if(Target->EndWindow != NULL)
+		{
+			Target->EndWindow();
+		}
+	}
+
+	FrameBuffer_EndTransfer();
+}
+
+/**
+ * @brief Start comparing dirty rectangle of defined index from its top left corner
+ */
+void FrameBuffer_SetTransferRect(unsigned char index)
+{
+	TransferRect = index;
+	if(index < Transfer->DirtyCount)
+	{
+		TransferRow = Transfer->DirtyRects[index].Y;
+		TransferByte = PixelFormat_GetBytes(Format, Transfer->DirtyRects[index].X);
+	}
+}
+
+/**
+ * @brief Find next run of pixels that differ from screen rows kept by target, in row TransferRow
+ *
+ * @details Rows target does not keep are sent whole. Runs separated by no more than
+ * FRAMEBUFFER_DIFF_GAP_BYTES unchanged bytes are joined.
+ *
+ * @param x, count - receive leftmost pixel and length of the run
+ *
+ * @return TRUE when run was found, FALSE when dirty rectangles hold no more changes
+ */
+bool FrameBuffer_FindRun(unsigned int *x, unsigned int *count)
+{
+	const FRAMEBUFFER_RECT_TYPE *rect;
+	const unsigned char *row, *reference;
+	unsigned int start, stop, next, end, x_end;
+
+	while(TransferRect < Transfer->DirtyCount)
+	{
+		rect = &Transfer->DirtyRects[TransferRect];
+		end = PixelFormat_GetBytes(Format, rect->X + rect->Width);
+
+		for( ; TransferRow < rect->Y + rect->Height; TransferRow++, TransferByte = PixelFormat_GetBytes(Format, rect->X))
+		{
+			row = FrameBuffer_GetRow(Transfer, TransferRow);
+			reference = Target->GetRow(TransferRow);
+
+			start = TransferByte;
+			stop = end;
+			next = end;
+			if(reference != NULL)
+			{
+				start = FrameBuffer_SkipEqual(row, reference, start, end);
+				if(start == end)
+				{
+					continue;
+				}
+				stop = FrameBuffer_SkipChanged(row, reference, start, end);
+				next = FrameBuffer_SkipEqual(row, reference, stop, end);
+				while( (next < end) && (next - stop <= FRAMEBUFFER_DIFF_GAP_BYTES) )
+				{
+					FlushStats.Gaps++;
+					stop = FrameBuffer_SkipChanged(row, reference, next, end);
+					next = FrameBuffer_SkipEqual(row, reference, stop, end);
+				}
+			}
+			if(start == end)
+			{
+				continue;
+			}
+
+			//Bytes to whole pixels, packed pixels of the rectangle start and end at byte boundary
+			*x = start * 8 / Format->BitsPerPixel;
+			x_end = (stop * 8 + Format->BitsPerPixel - 1) / Format->BitsPerPixel;
+			if(x_end > (unsigned int)rect->X + rect->Width)
+			{
+				x_end = rect->X + rect->Width;
+			}
+			*count = x_end - *x;
+
+			//Bytes up to next changed one are equal
+			TransferByte = PixelFormat_GetBytes(Format, x_end);
+			if(TransferByte < next)
+			{
+				TransferByte = next;
+			}
+			return TRUE;
+		}
+
+		FrameBuffer_SetTransferRect(TransferRect + 1);
+	}
+	return FALSE;
+}
+
+/**
+ * @brief Compare kernel, skip bytes where two rows are equal, word by word when both are aligned alike
+ *
+ * @return index of first byte in start..end - 1 that differs, end when there is none
+ */
+unsigned int FrameBuffer_SkipEqual(const unsigned char *a, const unsigned char *b, unsigned int start, unsigned int end)
+{
+	unsigned long word_a, word_b;
+
+	//Bytes up to word boundary of a
+	while( (start < end) && ( ((size_t)(a + start) % sizeof(unsigned long)) != 0 ) )
+	{
+		if(a[start] != b[start])
+		{
+			return start;
+		}
+		start++;
+	}
+
+	if( ((size_t)(b + start) % sizeof(unsigned long)) == 0 )
+	{
+		while(end - start >= sizeof(unsigned long))
+		{
+			//Aligned word loads, memcpy keeps them clear of aliasing rules
+			memcpy(&word_a, a + start, sizeof(word_a));
+			memcpy(&word_b, b + start, sizeof(word_b));
+			if(word_a != word_b)
+			{
+				break;
+			}
+			start += sizeof(unsigned long);
+		}
+	}
+
+	while( (start < end) && (a[start] == b[start]) )
+	{
+		start++;
+	}
+	return start;
+}
+
+/**
+ * @brief Compare kernel, skip bytes where two rows differ
+ *
+ * @return index of first byte in start..end - 1 that is equal, end when there is none
+ */
+unsigned int FrameBuffer_SkipChanged(const unsigned char *a, const unsigned char *b, unsigned int start, unsigned int end)
+{
+	while( (start < end) && (a[start] != b[start]) )
+	{
+		start++;
+	}
+	return start;
+}
+#endif
+
+#if (GRAPHIC_DRIVER_FRAMEBUFFER_COUNT > 1)
+/**
+ * @brief Copy dirty rectangles and band placement of one buffer into another
+ *
+ * @details Buffers hold the same picture afterwards, provided they did when drawing into from started.
+ * Band moved by FrameBuffer_SetBand is dirty as a whole, so it is copied whole.
+ */
+void FrameBuffer_CopyRects(FRAMEBUFFER_TYPE *to, const FRAMEBUFFER_TYPE *from)
+{
+	unsigned char i;
+	unsigned short row;
+	unsigned long offset, bytes;
+	const FRAMEBUFFER_RECT_TYPE *rect;
+
+	to->BandY = from->BandY;
+	to->BandYEnd = from->BandYEnd;
+	to->DirtyCount = 0;
+
+	for(i = 0; i < from->DirtyCount; i++)
+	{
+		rect = &from->DirtyRects[i];
+		offset = PixelFormat_GetBytes(Format, rect->X);
+		bytes = PixelFormat_GetBytes(Format, rect->X + rect->Width) - offset;
+		for(row = rect->Y; row < rect->Y + rect->Height; row++)
+		{
+			memcpy(FrameBuffer_GetRow(to, row) + offset, FrameBuffer_GetRow(from, row) + offset, bytes);
+		}
+	}
+}
+#endif
+
+/**
+ * @brief Store pixel data into current window row by row
+ *
+ * @param pixels - pixel data, or NULL to store color count times
+ * @param color - color used when pixels is NULL
+ * @param count - number of pixels
+ */
+void FrameBuffer_PushRun(const void *pixels, unsigned int color, unsigned int count)
+{
+	unsigned int run, column_end, pixels_x = 0;
+	unsigned int first_x = WindowX, first_y = WindowY, last_y;
+
+	FrameBuffer_WaitDraw();
+
+	while( (count > 0) && (WindowY <= WindowYEnd) )
+	{
+		//Part of the run that fits into current window row
+		run = WindowXEnd - WindowX + 1;
+		if(run > count)
+		{
+			run = count;
+		}
+
+		if( (WindowY >= Draw->BandY) && (WindowY < Draw->BandYEnd) )
+		{
+			column_end = WindowX + run;
+			if(column_end > Width)
+			{
+				column_end = Width;
+			}
+			if(WindowX >= column_end)
+			{
+				//Window row is outside of the screen
+			}
+			else if(pixels != NULL)
+			{
+				Format->Copy(FrameBuffer_GetRow(Draw, WindowY), WindowX, pixels, pixels_x, column_end - WindowX);
+			}
+			else
+			{
+				Format->Fill(FrameBuffer_GetRow(Draw, WindowY), WindowX, column_end - WindowX, color);
+			}
+		}
+
+		pixels_x += run;
+		count -= run;
+		WindowX += run;
+
+		if(WindowX > WindowXEnd)
+		{
+			WindowX = WindowXStart;
+			WindowY++;
+		}
+	}
+
+	//Mark touched part of the window, a single row exactly or whole window width otherwise
+	if(first_y == WindowY)
+	{
+		FrameBuffer_AddDamage(first_y, first_y + 1);
+		FrameBuffer_AddDirtyRect(first_x, first_y, WindowX, first_y + 1);
+	}
+	else
+	{
+		last_y = (WindowX == WindowXStart) ? WindowY : WindowY + 1;
+		FrameBuffer_AddDamage(first_y, last_y);
+		FrameBuffer_AddDirtyRect(WindowXStart, first_y, WindowXEnd + 1, last_y);
+	}
+}
+
+/**
+ * @brief Extend damaged rows by y..y_end - 1, rows outside of the screen are ignored
+ */
+void FrameBuffer_AddDamage(unsigned int y, unsigned int y_end)
+{
+	if(y_end > Height)
+	{
+		y_end = Height;
+	}
+	if(y >= y_end)
+	{
+		return;
+	}
+
+	if(y < DamageYStart)
+	{
+		DamageYStart = y;
+	}
+	if(y_end > DamageYEnd)
+	{
+		DamageYEnd = y_end;
+	}
+}
+
+/**
+ * @brief Add rectangle to dirty list, merging it with existing ones under bus cost model
+ *
+ * @param x, y - top left corner, inclusive
+ * @param x_end, y_end - bottom right corner, exclusive
+ */
+void FrameBuffer_AddDirtyRect(unsigned int x, unsigned int y, unsigned int x_end, unsigned int y_end)
+{
+	FRAMEBUFFER_RECT_TYPE rect, merged;
+	unsigned long cost, best_cost;
+	unsigned char i, best_index;
+
+	//Packed pixels are transferred in whole bytes
+	x -= x % Align;
+	x_end += (Align - x_end % Align) % Align;
+	if(x_end > Width)
+	{
+		x_end = Width;
+	}
+	if(y < Draw->BandY)
+	{
+		y = Draw->BandY;
+	}
+	if(y_end > Draw->BandYEnd)
+	{
+		y_end = Draw->BandYEnd;
+	}
+	if( (x >= x_end) || (y >= y_end) )
+	{
+		return;
+	}
+
+	rect.X = x;
+	rect.Y = y;
+	rect.Width = x_end - x;
+	rect.Height = y_end - y;
+
+	//Merge with every rectangle for which bounding box is not more expensive, repeat until nothing merges
+	for(i = 0; i < Draw->DirtyCount; )
+	{
+		merged = FrameBuffer_GetBoundingRect(&rect, &Draw->DirtyRects[i]);
+		if(FrameBuffer_GetRectCost(&merged) <= FrameBuffer_GetRectCost(&rect) + FrameBuffer_GetRectCost(&Draw->DirtyRects[i]))
+		{
+			rect = merged;
+			Draw->DirtyRects[i] = Draw->DirtyRects[--Draw->DirtyCount];
+			i = 0;
+		}
+		else
+		{
+			i++;
+		}
+	}
+
+	if(Draw->DirtyCount < FRAMEBUFFER_MAX_DIRTY_RECTS)
+	{
+		Draw->DirtyRects[Draw->DirtyCount++] = rect;
+		return;
+	}
+
+	//List is full, merge with rectangle that gives the cheapest bounding box
+	best_index = 0;
+	best_cost = 0xFFFFFFFF;
+	for(i = 0; i < Draw->DirtyCount; i++)
+	{
+		merged = FrameBuffer_GetBoundingRect(&rect, &Draw->DirtyRects[i]);
+		cost = FrameBuffer_GetRectCost(&merged) - FrameBuffer_GetRectCost(&Draw->DirtyRects[i]);
+		if(cost < best_cost)
+		{
+			best_cost = cost;
+			best_index = i;
+		}
+	}
+	rect = FrameBuffer_GetBoundingRect(&rect, &Draw->DirtyRects[best_index]);
+	Draw->DirtyRects[best_index] = Draw->DirtyRects[--Draw->DirtyCount];
+	FrameBuffer_AddDirtyRect(rect.X, rect.Y, rect.X + rect.Width, rect.Y + rect.Height);
+}
+
+/**
+ * @brief Get bus cost of transferring rectangle in bytes
+ */
+unsigned long FrameBuffer_GetRectCost(const FRAMEBUFFER_RECT_TYPE *rect)
+{
+	return FRAMEBUFFER_WINDOW_BYTES + PixelFormat_GetBytes(Format, rect->Width) * rect->Height;
+}
+
+/**
+ * @brief Get bounding box of two rectangles
+ */
+FRAMEBUFFER_RECT_TYPE FrameBuffer_GetBoundingRect(const FRAMEBUFFER_RECT_TYPE *a, const FRAMEBUFFER_RECT_TYPE *b)
+{
+	FRAMEBUFFER_RECT_TYPE rect;
+	unsigned short x_end, y_end;
+
+	rect.X = (a->X < b->X) ? a->X : b->X;
+	rect.Y = (a->Y < b->Y) ? a->Y : b->Y;
+	x_end = ( (a->X + a->Width) > (b->X + b->Width) ) ? (a->X + a->Width) : (b->X + b->Width);
+	y_end = ( (a->Y + a->Height) > (b->Y + b->Height) ) ? (a->Y + a->Height) : (b->Y + b->Height);
+	rect.Width = x_end - rect.X;
+	rect.Height = y_end - rect.Y;
+
+	return rect;
+}
+
+#endif /* GRAPHIC_DRIVER_FRAMEBUFFER */
@@ -0,0 +1,102 @@
+/**
+ * @file FrameBuffer.h
+ *
+ * @brief FrameBuffer module API.
+ *
+ * @author Krzysztof Grzeszczak
+ *
+ * @version 1.0
+ *
+ * @date 2012-2013
+ *
+ * @copyright GNU Public License
+ */
+
+#ifndef FRAMEBUFFER_H_
+#define FRAMEBUFFER_H_
+
+#include "GraphicDriver.h"
+#include "../Typedefs.h"
+
+//! R5 G6 B5 color of band cleared by FrameBuffer_SetBand
+#ifndef FRAMEBUFFER_BACKGROUND_COLOR
+#define FRAMEBUFFER_BACKGROUND_COLOR	0x0000
+#endif
+
+//! Maximum number of dirty rectangles tracked between two flushes
+#ifndef FRAMEBUFFER_MAX_DIRTY_RECTS
+#define FRAMEBUFFER_MAX_DIRTY_RECTS		16
+#endif
+
+//! Bus bytes of one LCD window setup (column address set, page address set and memory write)
+#ifndef FRAMEBUFFER_WINDOW_BYTES
+#define FRAMEBUFFER_WINDOW_BYTES		11
+#endif
+
+//! Set to 1 to transfer only pixels that differ from what LCD shows. Dirty rectangle rows are compared
+//! with screen rows target driver keeps in RAM (GetRow entry, i.e. GRAPHIC_DRIVER_SHADOW enabled) and only
+//! changed runs are sent, one window each. Without such target dirty rectangles are transferred whole.
+#ifndef FRAMEBUFFER_DIFF
+#define FRAMEBUFFER_DIFF				0
+#endif
+
+//! Largest unchanged gap in bytes between two changed runs of a row that is sent along, so the runs
+//! take one window. Default breaks even with the window setup it saves.
+#ifndef FRAMEBUFFER_DIFF_GAP_BYTES
+#define FRAMEBUFFER_DIFF_GAP_BYTES		FRAMEBUFFER_WINDOW_BYTES
+#endif
+
+//! Rectangle type, covers X..X + Width - 1 and Y..Y + Height - 1
+typedef struct
+{
+	unsigned short X;
+	unsigned short Y;
+	unsigned short Width;
+	unsigned short Height;
+} FRAMEBUFFER_RECT_TYPE;
+
+//! Transfer statistics of one flush
+typedef struct
+{
+	unsigned short Rects;		//!< Windows sent to LCD
+	unsigned long Pixels;		//!< Pixels sent to LCD
+	unsigned long Bytes;		//!< Bus bytes, FRAMEBUFFER_WINDOW_BYTES per window and pixel data bytes of every row
+	unsigned long Runs;			//!< Changed runs sent with FRAMEBUFFER_DIFF, one window each
+	unsigned long Gaps;			//!< Unchanged gaps sent along within runs with FRAMEBUFFER_DIFF
+} FRAMEBUFFER_FLUSH_STATS_TYPE;
+
+//! One frame buffer with its own band placement and dirty rectangles
+typedef struct
+{
+	unsigned short Pixels[(GRAPHIC_DRIVER_FRAMEBUFFER_LINES * GRAPHIC_DRIVER_MAX_WIDTH * GRAPHIC_DRIVER_FRAMEBUFFER_BPP + 15) / 16];	//!< Pixel data of the band in target format, rows packed with screen width
+	unsigned int BandY;							//!< Top screen row held in the buffer
+	unsigned int BandYEnd;						//!< Screen row just below the band
+	FRAMEBUFFER_RECT_TYPE DirtyRects[FRAMEBUFFER_MAX_DIRTY_RECTS];	//!< Rectangles touched since last flush
+	unsigned char DirtyCount;					//!< Number of valid entries in DirtyRects
+} FRAMEBUFFER_TYPE;
+
+extern const GRAPHIC_DRIVER_TYPE FrameBuffer_Driver;
+
+void FrameBuffer_SetTarget(const GRAPHIC_DRIVER_TYPE *target);
+void FrameBuffer_Initialize(void);
+void FrameBuffer_DrawPoint(unsigned short x, unsigned short y, unsigned int color);
+unsigned int FrameBuffer_GetPoint(unsigned short x, unsigned short y);
+void FrameBuffer_ReadSpan(unsigned short x, unsigned short y, unsigned short length, void *pixels);
+void FrameBuffer_FillRect(unsigned short x, unsigned short y, unsigned short width, unsigned short height, unsigned int color);
+void FrameBuffer_WriteSpan(unsigned short x, unsigned short y, unsigned short length, const void *pixels);
+void FrameBuffer_DrawMask(unsigned short x, unsigned short y, unsigned short width, unsigned long mask, unsigned int color);
+void FrameBuffer_BeginWindow(unsigned short x_start, unsigned short y_start, unsigned short x_end, unsigned short y_end);
+void FrameBuffer_PushPixels(const void *pixels, unsigned int count);
+void FrameBuffer_PushColor(unsigned int color, unsigned int count);
+void FrameBuffer_EndWindow(void);
+void FrameBuffer_Flush(void);
+void FrameBuffer_FlushAsync(GRAPHIC_DRIVER_CALLBACK_TYPE done);
+void FrameBuffer_WaitTransfer(void);
+void FrameBuffer_TransferComplete(void);
+unsigned short FrameBuffer_GetBandHeight(void);
+void FrameBuffer_SetBand(unsigned short y);
+bool FrameBuffer_GetDamagedRows(unsigned short *y_start, unsigned short *y_end);
+const FRAMEBUFFER_RECT_TYPE* FrameBuffer_GetDirtyRects(unsigned char *count);
+FRAMEBUFFER_FLUSH_STATS_TYPE FrameBuffer_GetFlushStats(void);
+
+#endif /* FRAMEBUFFER_H_ */
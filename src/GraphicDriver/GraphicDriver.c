@@ -1,10 +1,38 @@
 /**
  * @file GraphicDriver.c
  *
- * @brief Set of hardware dependent functions to support basic graphic functionality
+ * @brief Set of functions to support basic graphic functionality on top of display driver
  *
- * @details User needs to implement LCD driver initialization and function that draws one-pixel point at
- * define x and y coordinate
+ * @details Display driver is a GRAPHIC_DRIVER_TYPE descriptor, e.g. LcdPort_Driver for the panel,
+ * LcdHost_Driver for host stand-in or FrameBuffer_Driver for RAM frame buffer, so several of them
+ * can be linked into one binary and selected at runtime. Every descriptor entry is optional.
+ * GraphicDriver_SetDriver resolves missing entries once, with the fastest available replacement:
+ * rectangles and spans become one window and one burst of pixel data when driver streams into
+ * column/row windows, windows become one-pixel points otherwise.
+ *
+ * Colors given to GraphicDriver functions are R5 G6 B5. Descriptor PixelFormat selects the kernels
+ * used to convert them: a color once per call, pixel data chunk by chunk, with no conversion at all
+ * for R5 G6 B5 display.
+ *
+ * Several displays can be driven at once, each GRAPHIC_DRIVER_DISPLAY_TYPE instance holds driver, resolution,
+ * rotation and pixel format of one display. Functions work on display selected with GraphicDriver_SelectDisplay,
+ * the default display unless another one is selected. Frame buffer and shadow are single, they serve the display
+ * driver is set for first, other displays are drawn straight.
+ *
+ * Screen resolution and rotation are runtime properties. Unless driver rotates in hardware, rotation
+ * is applied to whole rectangles and spans: rotated rectangle is still one rectangle on the panel,
+ * so a fill stays one burst, and a span becomes one panel row or column, streamed backwards
+ * for 180 and 270 degrees. Pixel streams into multi-row windows are split into spans.
+ *
+ * With GRAPHIC_DRIVER_STATS enabled every drawing call is counted, with its pixels and pixel data bytes, for the
+ * caller set with GraphicDriver_BeginCaller, e.g. GUI component being drawn. Counters of the frame being drawn
+ * are kept apart from those of the last finished frame and from cumulative ones.
+ *
+ * With GRAPHIC_DRIVER_VSYNC enabled flushes are paced with LCD tearing effect signal. First flush of a frame
+ * waits for TE pulse, so transfer starts as the panel starts to scan from the top row and follows just behind
+ * the scanline. In banded mode the following bands of the frame go out right after one another, still behind
+ * the scanline. It is tear-free as long as the transfer does not outrun the scan nor lag a whole refresh
+ * period behind, which is counted as missed deadline.
  *
  * @author Krzysztof Grzeszczak
  *
@@ -16,29 +44,354 @@
  */
 
 #include "GraphicDriver.h"
+#include "FrameBuffer.h"
+#include "ShadowBuffer.h"
+#include <stddef.h>
+
+//! Pixels converted or reversed at once
+#define GRAPHIC_DRIVER_CHUNK_PIXELS		32
+
+//! Size of chunk buffer in 16-bit words, enough for the widest pixel format
+#define GRAPHIC_DRIVER_CHUNK_WORDS		((GRAPHIC_DRIVER_CHUNK_PIXELS * 24 + 15) / 16)
+
+//! Number of bits in row mask
+#define GRAPHIC_DRIVER_MASK_BITS		(sizeof(unsigned long) * 8)
+
+#if (GRAPHIC_DRIVER_STATS != 0)
+//! Nesting depth of GraphicDriver_BeginCaller calls that is kept track of
+#define GRAPHIC_DRIVER_CALLER_DEPTH		8
+#endif
+
+#if (GRAPHIC_DRIVER_VSYNC != 0)
+//! Shorthand for waiting loops, gives CPU to display driver if it wants it
+#define GRAPHIC_DRIVER_IDLE()	do{ if(Display->Panel.Idle != NULL){ Display->Panel.Idle(); } }while(0)
+#endif
+
+#if (GRAPHIC_DRIVER_SHADOW != 0) || (GRAPHIC_DRIVER_FRAMEBUFFER != 0)
+static GRAPHIC_DRIVER_DISPLAY_TYPE *BufferedDisplay;	//!< Display frame buffer and shadow serve, NULL until first one is set up
+#endif
+#if (GRAPHIC_DRIVER_SHADOW != 0)
+static GRAPHIC_DRIVER_TYPE Shadow;			//!< Shadow buffer entries in front of Screen
+#endif
+static unsigned short WindowXStart;			//!< Leftmost column of emulated window
+static unsigned short WindowXEnd;			//!< Rightmost column of emulated window
+static unsigned short WindowX;				//!< Column of next pixel in emulated window
+static unsigned short WindowY;				//!< Row of next pixel in emulated window
+static unsigned short RotatedXStart;		//!< Leftmost column of rotated window, screen coordinates
+static unsigned short RotatedXEnd;			//!< Rightmost column of rotated window
+static unsigned short RotatedYEnd;			//!< Bottom row of rotated window
+static unsigned short RotatedX;				//!< Column of next pixel in rotated window
+static unsigned short RotatedY;				//!< Row of next pixel in rotated window
+#if (GRAPHIC_DRIVER_STATS != 0)
+static GRAPHIC_DRIVER_STATS_TYPE Stats[CALLER_COUNT];		//!< Statistics of frame being drawn
+static GRAPHIC_DRIVER_STATS_TYPE FrameStats[CALLER_COUNT];	//!< Statistics of last finished frame
+static GRAPHIC_DRIVER_STATS_TYPE TotalStats[CALLER_COUNT];	//!< Statistics of frames finished since reset
+static unsigned long FrameCount;							//!< Frames finished since reset
+static GRAPHIC_DRIVER_CALLER_TYPE Caller = CALLER_OTHER;	//!< Caller drawing is counted for
+static GRAPHIC_DRIVER_CALLER_TYPE Callers[GRAPHIC_DRIVER_CALLER_DEPTH];	//!< Callers to restore by GraphicDriver_EndCaller
+static unsigned char CallerDepth;							//!< Nesting depth of GraphicDriver_BeginCaller calls
+#endif
+#if (GRAPHIC_DRIVER_VSYNC != 0)
+static volatile unsigned long VSyncs;				//!< TE pulses since statistics reset
+static volatile unsigned long PresentVSync;		//!< Value of VSyncs when current frame started
+static volatile bool IsPresenting = FALSE;		//!< TRUE while flush transfer is running
+static volatile bool IsFrameMissed = FALSE;		//!< TRUE once current frame missed its deadline
+static GRAPHIC_DRIVER_CALLBACK_TYPE volatile PresentDone;	//!< Completion callback of running flush
+static unsigned long Frames;						//!< Frames presented since statistics reset
+static unsigned long Missed;						//!< Frames that missed their deadline since statistics reset
+static unsigned short BandY;						//!< Top row of current band
+static bool IsFrameOpen = FALSE;					//!< TRUE while bands of current frame are flushed
+#endif
+
+static void GraphicDriver_DrawPointWindow(unsigned short x, unsigned short y, unsigned int color);
+static void GraphicDriver_DrawPointNone(unsigned short x, unsigned short y, unsigned int color);
+static unsigned int GraphicDriver_GetPointNone(unsigned short x, unsigned short y);
+static void GraphicDriver_ReadSpanPoints(unsigned short x, unsigned short y, unsigned short length, void *pixels);
+static void GraphicDriver_FillRectWindow(unsigned short x, unsigned short y, unsigned short width, unsigned short height, unsigned int color);
+static void GraphicDriver_WriteSpanWindow(unsigned short x, unsigned short y, unsigned short length, const void *pixels);
+static void GraphicDriver_DrawMaskRuns(unsigned short x, unsigned short y, unsigned short width, unsigned long mask, unsigned int color);
+static unsigned short GraphicDriver_CountTrailingZeros(unsigned long bits);
+static void GraphicDriver_SetWindowPoints(unsigned short x_start, unsigned short y_start, unsigned short x_end, unsigned short y_end);
+static void GraphicDriver_WritePixelsPoints(const void *pixels, unsigned int count);
+static void GraphicDriver_WriteColorPoints(unsigned int color, unsigned int count);
+static void GraphicDriver_EndWindowNone(void);
+static void GraphicDriver_WritePixels(const unsigned short *pixels, unsigned int count);
+static void GraphicDriver_SetScreen(void);
+static bool GraphicDriver_ClipRect(unsigned short *x, unsigned short *y, unsigned short *width, unsigned short *height);
+static void GraphicDriver_RotateRect(unsigned short *x, unsigned short *y, unsigned short *width, unsigned short *height);
+static void GraphicDriver_RotatedDrawPoint(unsigned short x, unsigned short y, unsigned int color);
+static unsigned int GraphicDriver_RotatedGetPoint(unsigned short x, unsigned short y);
+static void GraphicDriver_RotatedFillRect(unsigned short x, unsigned short y, unsigned short width, unsigned short height, unsigned int color);
+static void GraphicDriver_RotatedWriteSpan(unsigned short x, unsigned short y, unsigned short length, const void *pixels);
+static void GraphicDriver_RotatedWriteRun(unsigned short x, unsigned short y, unsigned short length, const void *pixels, unsigned int pixels_x);
+static void GraphicDriver_RotatedSetWindow(unsigned short x_start, unsigned short y_start, unsigned short x_end, unsigned short y_end);
+static void GraphicDriver_RotatedWritePixels(const void *pixels, unsigned int count);
+static void GraphicDriver_RotatedWriteColor(unsigned int color, unsigned int count);
+#if (GRAPHIC_DRIVER_VSYNC != 0)
+static void GraphicDriver_BeginPresent(void);
+static void GraphicDriver_EndPresent(void);
+#endif
+#if (GRAPHIC_DRIVER_STATS != 0)
+static void GraphicDriver_CountCall(unsigned long *calls, unsigned long pixels);
+#endif
+
+//! Entries of display without driver, default resolution like driver without one, drawing is dropped and read back returns 0
+#define GRAPHIC_DRIVER_NONE		{ NULL, GraphicDriver_DrawPointNone, GraphicDriver_GetPointNone, GraphicDriver_ReadSpanPoints, NULL, \
+								GraphicDriver_FillRectWindow, GraphicDriver_WriteSpanWindow, GraphicDriver_DrawMaskRuns, \
+								GraphicDriver_SetWindowPoints, GraphicDriver_WritePixelsPoints, GraphicDriver_WriteColorPoints, \
+								GraphicDriver_EndWindowNone, NULL, NULL, NULL, NULL, NULL, NULL, NULL, NULL, \
+								GRAPHIC_DRIVER_MAX_WIDTH, GRAPHIC_DRIVER_MAX_HEIGHT, PIXEL_FORMAT_RGB565 }
+
+//! Display selected unless another one is, safe to draw on before GraphicDriver_Initialize
+static GRAPHIC_DRIVER_DISPLAY_TYPE DefaultDisplay =
+{
+	NULL,
+	GRAPHIC_DRIVER_NONE,
+	GRAPHIC_DRIVER_NONE,
+	GRAPHIC_DRIVER_NONE,
+	ROTATION_0,
+	&PixelFormat_Kernels[PIXEL_FORMAT_RGB565]
+};
+static GRAPHIC_DRIVER_DISPLAY_TYPE *Display = &DefaultDisplay;	//!< Display functions work on
 
 /**
- * @brief Initialize LCD module and enable it
- * @todo Add specific LCD and MCU wise implementation
+ * @brief Select display driver and initialize it
+ *
+ * @details With GRAPHIC_DRIVER_FRAMEBUFFER enabled drawing goes into FrameBuffer module, which
+ * transfers it to driver on GraphicDriver_Flush. With GRAPHIC_DRIVER_SHADOW enabled ShadowBuffer
+ * module keeps a copy of everything sent to driver. Current rotation is kept. Until the first call
+ * default display has no driver, drawing on it is dropped and read back returns 0.
+ *
+ * @param driver - pointer to display driver descriptor
  */
-void GraphicDriver_Initialize(void)
+void GraphicDriver_Initialize(const GRAPHIC_DRIVER_TYPE *driver)
 {
-	do{}while(0);
+	GraphicDriver_SetDriver(driver);
+	if(Display->Ops.Initialize != NULL)
+	{
+		Display->Ops.Initialize();
+	}
+	if(Display->Panel.SetRotation != NULL)
+	{
+		Display->Panel.SetRotation(Display->Rotation);
+	}
+}
+
+/**
+ * @brief Select display driver without initializing it, e.g. to swap in instrumented driver
+ *
+ * @param driver - pointer to display driver descriptor, has to stay valid while selected
+ */
+void GraphicDriver_SetDriver(const GRAPHIC_DRIVER_TYPE *driver)
+{
+	Display->Driver = driver;
+	Display->Ops = *driver;
+
+	if(Display->Ops.DrawPoint == NULL)
+	{
+		Display->Ops.DrawPoint = (driver->SetWindow != NULL) ? GraphicDriver_DrawPointWindow : GraphicDriver_DrawPointNone;
+	}
+	if(Display->Ops.GetPoint == NULL)
+	{
+		Display->Ops.GetPoint = GraphicDriver_GetPointNone;
+	}
+	if(Display->Ops.ReadSpan == NULL)
+	{
+		Display->Ops.ReadSpan = GraphicDriver_ReadSpanPoints;
+	}
+	if(Display->Ops.SetWindow == NULL)
+	{
+		Display->Ops.SetWindow = GraphicDriver_SetWindowPoints;
+		Display->Ops.WritePixels = GraphicDriver_WritePixelsPoints;
+		Display->Ops.WriteColor = GraphicDriver_WriteColorPoints;
+		Display->Ops.EndWindow = NULL;
+	}
+	if(Display->Ops.EndWindow == NULL)
+	{
+		Display->Ops.EndWindow = GraphicDriver_EndWindowNone;
+	}
+	if(Display->Ops.FillRect == NULL)
+	{
+		Display->Ops.FillRect = GraphicDriver_FillRectWindow;
+	}
+	if(Display->Ops.WriteSpan == NULL)
+	{
+		Display->Ops.WriteSpan = GraphicDriver_WriteSpanWindow;
+	}
+	if(Display->Ops.DrawMask == NULL)
+	{
+		Display->Ops.DrawMask = GraphicDriver_DrawMaskRuns;
+	}
+	if(Display->Ops.Width == 0)
+	{
+		Display->Ops.Width = GRAPHIC_DRIVER_MAX_WIDTH;
+	}
+	if(Display->Ops.Height == 0)
+	{
+		Display->Ops.Height = GRAPHIC_DRIVER_MAX_HEIGHT;
+	}
+
+	Display->Panel = Display->Ops;
+	Display->Format = PixelFormat_GetKernels(Display->Panel.PixelFormat);
+	GraphicDriver_SetScreen();
+}
+
+/**
+ * @brief Get display driver selected with GraphicDriver_SetDriver
+ */
+const GRAPHIC_DRIVER_TYPE* GraphicDriver_GetDriver(void)
+{
+	return Display->Driver;
+}
+
+/**
+ * @brief Select display further GraphicDriver functions work on, e.g. to drive a secondary display
+ *
+ * @details New display is given its driver with GraphicDriver_Initialize while selected.
+ * Selection is kept until next call. Drawing window must not be open while the display is changed.
+ *
+ * @param display - zero initialized or already set up display instance, has to stay valid while used
+ * @return display selected before, so it can be selected back
+ */
+GRAPHIC_DRIVER_DISPLAY_TYPE* GraphicDriver_SelectDisplay(GRAPHIC_DRIVER_DISPLAY_TYPE *display)
+{
+	GRAPHIC_DRIVER_DISPLAY_TYPE *previous = Display;
+
+	Display = display;
+	return previous;
+}
+
+/**
+ * @brief Get display GraphicDriver functions work on
+ */
+GRAPHIC_DRIVER_DISPLAY_TYPE* GraphicDriver_GetDisplay(void)
+{
+	return Display;
+}
+
+/**
+ * @brief Rotate the screen clockwise
+ *
+ * @details Screen width and height are swapped for 90 and 270 degrees. Screen content is not
+ * redrawn, frame buffer is cleared.
+ */
+void GraphicDriver_SetRotation(GRAPHIC_DRIVER_ROTATION_TYPE rotation)
+{
+	Display->Rotation = rotation;
+	if(Display->Driver == NULL)
+	{
+		//Applied when driver is selected
+		return;
+	}
+	if(Display->Panel.SetRotation != NULL)
+	{
+		Display->Panel.SetRotation(rotation);
+	}
+	GraphicDriver_SetScreen();
+}
+
+/**
+ * @brief Get current screen rotation
+ */
+GRAPHIC_DRIVER_ROTATION_TYPE GraphicDriver_GetRotation(void)
+{
+	return Display->Rotation;
+}
+
+/**
+ * @brief Get screen width in pixel unit, rotation included
+ */
+unsigned short GraphicDriver_GetWidth(void)
+{
+	return Display->Screen.Width;
+}
+
+/**
+ * @brief Get screen height in pixel unit, rotation included
+ */
+unsigned short GraphicDriver_GetHeight(void)
+{
+	return Display->Screen.Height;
+}
+
+/**
+ * @brief Get panel width in pixel unit, rotation not included
+ */
+unsigned short GraphicDriver_GetPanelWidth(void)
+{
+	return Display->Panel.Width;
+}
+
+/**
+ * @brief Get panel height in pixel unit, rotation not included
+ */
+unsigned short GraphicDriver_GetPanelHeight(void)
+{
+	return Display->Panel.Height;
+}
+
+/**
+ * @brief Get kernels of display pixel format
+ */
+const PIXEL_FORMAT_KERNELS_TYPE* GraphicDriver_GetPixelFormat(void)
+{
+	return Display->Format;
+}
+
+/**
+ * @brief Transform panel coordinates, e.g. of touch event, into screen coordinates
+ *
+ * @details Panel coordinates are clamped to the panel first
+ */
+void GraphicDriver_PanelToScreen(unsigned short panel_x, unsigned short panel_y, unsigned short *x, unsigned short *y)
+{
+	if(panel_x >= Display->Panel.Width)
+	{
+		panel_x = Display->Panel.Width - 1;
+	}
+	if(panel_y >= Display->Panel.Height)
+	{
+		panel_y = Display->Panel.Height - 1;
+	}
+
+	switch(Display->Rotation)
+	{
+		case ROTATION_90:
+			*x = panel_y;
+			*y = Display->Panel.Width - 1 - panel_x;
+			break;
+
+		case ROTATION_180:
+			*x = Display->Panel.Width - 1 - panel_x;
+			*y = Display->Panel.Height - 1 - panel_y;
+			break;
+
+		case ROTATION_270:
+			*x = Display->Panel.Height - 1 - panel_y;
+			*y = panel_x;
+			break;
+
+		default:
+			*x = panel_x;
+			*y = panel_y;
+			break;
+	}
 }
 
 /**
  * @brief Draw one pixel with defined color on LCD
  *
  * @details Function draws point on the screen
- * x = <0, 319> px, horizontal coordinate
- * y = <0, 240> px, vertical coordinate
+ * x = <0, GraphicDriver_GetWidth() - 1> px, horizontal coordinate
+ * y = <0, GraphicDriver_GetHeight() - 1> px, vertical coordinate
  * color = <0x0000, 0xFFFF> 16-bit 5-6-5 format |RRRRR-GGGGGG-BBBBB| RGB color data
- *
- * @todo Add specific LCD and MCI wise implementation
  */
 void GraphicDriver_DrawPoint(unsigned short x, unsigned short y, unsigned int color)
 {
-	do{}while(0);
+#if (GRAPHIC_DRIVER_STATS != 0)
+	GraphicDriver_CountCall(&Stats[Caller].Points, 1);
+#endif
+	Display->Ops.DrawPoint(x, y, Display->Format->FromRgb565(color));
 }
 
 /**
@@ -46,9 +399,1075 @@ void GraphicDriver_DrawPoint(unsigned short x, unsigned short y, unsigned int co
  *
  * @details Use LCD internal memory to read color data from given coordinates x and y
  *
- * @todo This implementation is optional.
+ * @note Returns 0 if driver does not implement read back. With frame buffer or shadow buffer
+ * enabled color data is read from RAM. Color is as exact as display pixel format keeps it.
  */
 unsigned int GraphicDriver_GetPoint(unsigned short x, unsigned short y)
 {
+	return Display->Format->ToRgb565(Display->Ops.GetPoint(x, y));
+}
+
+/**
+ * @brief Read back rectangle of screen content, e.g. to restore what an overlay covers
+ *
+ * @details Rectangle covers x..x + width - 1 and y..y + height - 1 and has to be inside of the screen.
+ * With GRAPHIC_DRIVER_SHADOW enabled it is a copy from RAM, otherwise it is read from frame buffer or
+ * pixel by pixel from LCD. Saved rectangle is put back with GraphicDriver_BeginWindow and
+ * GraphicDriver_PushPixels.
+ *
+ * @param colors - R5 G6 B5 color data, width * height entries row by row
+ */
+void GraphicDriver_ReadRect(unsigned short x, unsigned short y, unsigned short width, unsigned short height, unsigned short *colors)
+{
+	unsigned short chunk[GRAPHIC_DRIVER_CHUNK_WORDS];
+	unsigned short row, column, run, i;
+
+	for(row = 0; row < height; row++)
+	{
+		if(Display->Panel.PixelFormat == PIXEL_FORMAT_RGB565)
+		{
+			Display->Ops.ReadSpan(x, y + row, width, colors);
+			colors += width;
+			continue;
+		}
+
+		for(column = 0; column < width; column += run)
+		{
+			run = (width - column < GRAPHIC_DRIVER_CHUNK_PIXELS) ? width - column : GRAPHIC_DRIVER_CHUNK_PIXELS;
+			Display->Ops.ReadSpan(x + column, y + row, run, chunk);
+			for(i = 0; i < run; i++)
+			{
+				*colors++ = (unsigned short)Display->Format->ToRgb565(Display->Format->Get(chunk, i));
+			}
+		}
+	}
+}
+
+/**
+ * @brief Open column/row window for pixel streaming
+ *
+ * @details Window covers x_start..x_end and y_start..y_end, both ends inclusive.
+ * Pixels pushed with GraphicDriver_PushPixels or GraphicDriver_PushColor fill the window
+ * row by row, left to right. Window has to be closed with GraphicDriver_EndWindow.
+ */
+void GraphicDriver_BeginWindow(unsigned short x_start, unsigned short y_start, unsigned short x_end, unsigned short y_end)
+{
+#if (GRAPHIC_DRIVER_STATS != 0)
+	GraphicDriver_CountCall(&Stats[Caller].Windows, 0);
+#endif
+	Display->Ops.SetWindow(x_start, y_start, x_end, y_end);
+}
+
+/**
+ * @brief Stream run of pixels into window opened with GraphicDriver_BeginWindow
+ *
+ * @param pixels - R5 G6 B5 color data, one entry per pixel
+ * @param count - number of pixels to write
+ */
+void GraphicDriver_PushPixels(const unsigned short *pixels, unsigned int count)
+{
+#if (GRAPHIC_DRIVER_STATS != 0)
+	GraphicDriver_CountCall(NULL, count);
+#endif
+	GraphicDriver_WritePixels(pixels, count);
+}
+
+/**
+ * @brief Stream run of pixels already in display pixel format into window opened with GraphicDriver_BeginWindow
+ *
+ * @param pixels - packed pixel data in format given by GraphicDriver_GetPixelFormat, e.g. prepared once and reused
+ * @param count - number of pixels to write
+ */
+void GraphicDriver_PushNative(const void *pixels, unsigned int count)
+{
+#if (GRAPHIC_DRIVER_STATS != 0)
+	GraphicDriver_CountCall(NULL, count);
+#endif
+	Display->Ops.WritePixels(pixels, count);
+}
+
+/**
+ * @brief Stream the same color count times into window opened with GraphicDriver_BeginWindow
+ */
+void GraphicDriver_PushColor(unsigned int color, unsigned int count)
+{
+#if (GRAPHIC_DRIVER_STATS != 0)
+	GraphicDriver_CountCall(NULL, count);
+#endif
+	Display->Ops.WriteColor(Display->Format->FromRgb565(color), count);
+}
+
+/**
+ * @brief Stream R5 G6 B5 color data into window, converted chunk by chunk unless display takes it as is
+ */
+void GraphicDriver_WritePixels(const unsigned short *pixels, unsigned int count)
+{
+	unsigned short chunk[GRAPHIC_DRIVER_CHUNK_WORDS];
+	unsigned int run;
+
+	if(Display->Panel.PixelFormat == PIXEL_FORMAT_RGB565)
+	{
+		Display->Ops.WritePixels(pixels, count);
+		return;
+	}
+
+	while(count > 0)
+	{
+		run = (count < GRAPHIC_DRIVER_CHUNK_PIXELS) ? count : GRAPHIC_DRIVER_CHUNK_PIXELS;
+		Display->Format->Convert(chunk, 0, pixels, run);
+		Display->Ops.WritePixels(chunk, run);
+		pixels += run;
+		count -= run;
+	}
+}
+
+/**
+ * @brief Close window opened with GraphicDriver_BeginWindow
+ */
+void GraphicDriver_EndWindow(void)
+{
+	Display->Ops.EndWindow();
+}
+
+/**
+ * @brief Transfer drawing made since last flush to LCD and wait until it has finished
+ *
+ * @details With GRAPHIC_DRIVER_VSYNC enabled first flush of a frame waits for TE pulse before the transfer starts.
+ *
+ * @note Does nothing when driver does not buffer drawing, since every drawing
+ * operation is already sent to LCD
+ */
+void GraphicDriver_Flush(void)
+{
+	if(Display->Ops.Flush != NULL)
+	{
+#if (GRAPHIC_DRIVER_VSYNC != 0)
+		GraphicDriver_BeginPresent();
+		Display->Ops.Flush();
+		GraphicDriver_EndPresent();
+#else
+		Display->Ops.Flush();
+#endif
+	}
+}
+
+/**
+ * @brief Start transfer of drawing made since last flush to LCD and return
+ *
+ * @details With frame buffer in front of driver providing WritePixelsAsync pixel data is sent by DMA
+ * while the caller goes on. With two frame buffers drawing goes into the other buffer meanwhile,
+ * with one buffer the next drawing operation waits for the transfer to finish. Next flush always
+ * waits for previous one.
+ *
+ * @param done - called when transfer has finished, possibly from interrupt context. May be NULL.
+ *
+ * @note Without asynchronous transfer support transfer is made before return. With GRAPHIC_DRIVER_VSYNC
+ * enabled first flush of a frame waits for TE pulse before the transfer starts.
+ */
+void GraphicDriver_FlushAsync(GRAPHIC_DRIVER_CALLBACK_TYPE done)
+{
+	if(Display->Ops.FlushAsync != NULL)
+	{
+#if (GRAPHIC_DRIVER_VSYNC != 0)
+		GraphicDriver_BeginPresent();
+		PresentDone = done;
+		Display->Ops.FlushAsync(GraphicDriver_EndPresent);
+#else
+		Display->Ops.FlushAsync(done);
+#endif
+		return;
+	}
+
+	GraphicDriver_Flush();
+	if(done != NULL)
+	{
+		done();
+	}
+}
+
+/**
+ * @brief DMA completion hook, display driver calls it when WritePixelsAsync transfer has finished
+ */
+void GraphicDriver_TransferComplete(void)
+{
+#if (GRAPHIC_DRIVER_FRAMEBUFFER != 0)
+	FrameBuffer_TransferComplete();
+#endif
+}
+
+/**
+ * @brief Get number of screen rows rendered at once
+ *
+ * @return Band height in banded frame buffer mode, screen height otherwise
+ */
+unsigned short GraphicDriver_GetBandHeight(void)
+{
+	unsigned short band_height = Display->Screen.Height;
+
+	if(Display->Ops.GetBandHeight != NULL)
+	{
+		band_height = Display->Ops.GetBandHeight();
+	}
+	return (band_height < Display->Screen.Height) ? band_height : Display->Screen.Height;
+}
+
+/**
+ * @brief Place band of GraphicDriver_GetBandHeight rows at defined screen row
+ *
+ * @details Drawing outside of the band is dropped until next call. Band placed at screen height
+ * drops all drawing. Does nothing unless banded frame buffer mode is enabled.
+ */
+void GraphicDriver_SetBand(unsigned short y)
+{
+	if(Display->Ops.SetBand != NULL)
+	{
+		Display->Ops.SetBand(y);
+
+#if (GRAPHIC_DRIVER_VSYNC != 0)
+		//Band parked below the screen or moved up ends the frame
+		if( (y >= Display->Screen.Height) || (y <= BandY) )
+		{
+			IsFrameOpen = FALSE;
+		}
+		BandY = y;
+#endif
+	}
+}
+
+/**
+ * @brief Get screen rows drawn since last call, including rows dropped outside of the band
+ *
+ * @return TRUE if anything was drawn, FALSE otherwise or when frame buffer is disabled
+ */
+bool GraphicDriver_GetDamagedRows(unsigned short *y_start, unsigned short *y_end)
+{
+	if(Display->Ops.GetDamagedRows != NULL)
+	{
+		return Display->Ops.GetDamagedRows(y_start, y_end);
+	}
+	return FALSE;
+}
+
+#if (GRAPHIC_DRIVER_VSYNC != 0)
+/**
+ * @brief TE hook, has to be called on every TE pulse, e.g. from TE line interrupt
+ *
+ * @details Frame whose transfer is still running at the TE pulse after the one it started at missed
+ * its deadline, the scan has gone through the whole screen meanwhile.
+ */
+void GraphicDriver_VSync(void)
+{
+	VSyncs++;
+	if( (IsPresenting == TRUE) && (IsFrameMissed == FALSE) && (VSyncs != PresentVSync) )
+	{
+		IsFrameMissed = TRUE;
+		Missed++;
+	}
+}
+
+/**
+ * @brief Get presentation statistics gathered since last reset
+ *
+ * @return GRAPHIC_DRIVER_VSYNC_STATS_TYPE copy of statistics
+ */
+GRAPHIC_DRIVER_VSYNC_STATS_TYPE GraphicDriver_GetVSyncStats(void)
+{
+	GRAPHIC_DRIVER_VSYNC_STATS_TYPE stats;
+
+	stats.VSyncs = VSyncs;
+	stats.Frames = Frames;
+	stats.Missed = Missed;
+	stats.FrameRate = (stats.VSyncs == 0) ? 0 : (unsigned short)(stats.Frames * GRAPHIC_DRIVER_VSYNC_HZ / stats.VSyncs);
+	return stats;
+}
+
+/**
+ * @brief Clear presentation statistics
+ */
+void GraphicDriver_ResetVSyncStats(void)
+{
+	//Keep running frame consistent with the counter
+	PresentVSync -= VSyncs;
+	VSyncs = 0;
+	Frames = 0;
+	Missed = 0;
+}
+
+/**
+ * @brief Wait for previous transfer and, when flush starts a new frame, for TE pulse
+ *
+ * @details Frame is the whole screen, or in banded mode bands flushed top to bottom. Its first
+ * transfer starts at TE pulse, the rest follow without waiting.
+ */
+void GraphicDriver_BeginPresent(void)
+{
+	unsigned long vsyncs;
+
+	while(IsPresenting == TRUE)
+	{
+		GRAPHIC_DRIVER_IDLE();
+	}
+
+	if(IsFrameOpen == FALSE)
+	{
+		vsyncs = VSyncs;
+		while(VSyncs == vsyncs)
+		{
+			GRAPHIC_DRIVER_IDLE();
+		}
+		PresentVSync = VSyncs;
+		IsFrameMissed = FALSE;
+		Frames++;
+	}
+
+	//Frame ends with band that reaches bottom of the screen
+	IsFrameOpen = (BandY + GraphicDriver_GetBandHeight() < Display->Screen.Height) ? TRUE : FALSE;
+	IsPresenting = TRUE;
+}
+
+/**
+ * @brief Flush completion, possibly from interrupt context. Calls completion callback of the flush.
+ */
+void GraphicDriver_EndPresent(void)
+{
+	GRAPHIC_DRIVER_CALLBACK_TYPE done = PresentDone;
+
+	PresentDone = NULL;
+	if( (IsFrameMissed == FALSE) && (VSyncs != PresentVSync) )
+	{
+		IsFrameMissed = TRUE;
+		Missed++;
+	}
+	IsPresenting = FALSE;
+
+	if(done != NULL)
+	{
+		done();
+	}
+}
+#endif
+
+#if (GRAPHIC_DRIVER_STATS != 0)
+/**
+ * @brief Count drawing for defined caller until matching GraphicDriver_EndCaller, e.g. while GUI component is drawn
+ *
+ * @details Calls nest, drawing is counted for the outermost caller other than CALLER_OTHER, so a Button
+ * caption counts for the Button.
+ */
+void GraphicDriver_BeginCaller(GRAPHIC_DRIVER_CALLER_TYPE caller)
+{
+	if(CallerDepth < GRAPHIC_DRIVER_CALLER_DEPTH)
+	{
+		Callers[CallerDepth] = Caller;
+	}
+	CallerDepth++;
+
+	if(Caller == CALLER_OTHER)
+	{
+		Caller = caller;
+	}
+}
+
+/**
+ * @brief Restore caller drawing was counted for before matching GraphicDriver_BeginCaller
+ */
+void GraphicDriver_EndCaller(void)
+{
+	if(CallerDepth == 0)
+	{
+		return;
+	}
+	CallerDepth--;
+
+	if(CallerDepth < GRAPHIC_DRIVER_CALLER_DEPTH)
+	{
+		Caller = Callers[CallerDepth];
+	}
+}
+
+/**
+ * @brief Finish frame, its statistics become last frame statistics and are added to cumulative ones
+ *
+ * @note Gui module finishes frame at the end of Gui_DrawView and Gui_Task
+ */
+void GraphicDriver_EndFrame(void)
+{
+	unsigned char i;
+
+	for(i = 0; i < CALLER_COUNT; i++)
+	{
+		FrameStats[i] = Stats[i];
+		TotalStats[i].Points += Stats[i].Points;
+		TotalStats[i].Rects += Stats[i].Rects;
+		TotalStats[i].Spans += Stats[i].Spans;
+		TotalStats[i].Masks += Stats[i].Masks;
+		TotalStats[i].Windows += Stats[i].Windows;
+		TotalStats[i].Pixels += Stats[i].Pixels;
+		TotalStats[i].Bytes += Stats[i].Bytes;
+		Stats[i] = (GRAPHIC_DRIVER_STATS_TYPE){0};
+	}
+	FrameCount++;
+}
+
+/**
+ * @brief Clear statistics of current, last and all frames
+ */
+void GraphicDriver_ResetStats(void)
+{
+	unsigned char i;
+
+	for(i = 0; i < CALLER_COUNT; i++)
+	{
+		Stats[i] = (GRAPHIC_DRIVER_STATS_TYPE){0};
+		FrameStats[i] = Stats[i];
+		TotalStats[i] = Stats[i];
+	}
+	FrameCount = 0;
+}
+
+/**
+ * @brief Get statistics of defined caller in last finished frame
+ */
+GRAPHIC_DRIVER_STATS_TYPE GraphicDriver_GetFrameStats(GRAPHIC_DRIVER_CALLER_TYPE caller)
+{
+	return FrameStats[caller];
+}
+
+/**
+ * @brief Get statistics of defined caller in all frames finished since reset
+ */
+GRAPHIC_DRIVER_STATS_TYPE GraphicDriver_GetTotalStats(GRAPHIC_DRIVER_CALLER_TYPE caller)
+{
+	return TotalStats[caller];
+}
+
+/**
+ * @brief Get number of frames finished since reset
+ */
+unsigned long GraphicDriver_GetFrameCount(void)
+{
+	return FrameCount;
+}
+
+/**
+ * @brief Count drawing call of current caller with its pixels
+ *
+ * @param calls - call counter of current caller, NULL to count pixels only
+ * @param pixels - number of pixels drawn
+ */
+void GraphicDriver_CountCall(unsigned long *calls, unsigned long pixels)
+{
+	if(calls != NULL)
+	{
+		(*calls)++;
+	}
+	Stats[Caller].Pixels += pixels;
+	Stats[Caller].Bytes += PixelFormat_GetBytes(Display->Format, pixels);
+}
+#endif
+
+/**
+ * @brief Draw horizontal line of defined length and color
+ *
+ * @details Line starts at x, y and goes right through x + length - 1
+ */
+void GraphicDriver_DrawHLine(unsigned short x, unsigned short y, unsigned short length, unsigned int color)
+{
+	GraphicDriver_FillRect(x, y, length, 1, color);
+}
+
+/**
+ * @brief Draw vertical line of defined length and color
+ *
+ * @details Line starts at x, y and goes down through y + length - 1
+ */
+void GraphicDriver_DrawVLine(unsigned short x, unsigned short y, unsigned short length, unsigned int color)
+{
+	GraphicDriver_FillRect(x, y, 1, length, color);
+}
+
+/**
+ * @brief Fill rectangle with defined color
+ *
+ * @details Rectangle covers x..x + width - 1 and y..y + height - 1.
+ * It costs one window setup and one burst of color data unless driver fills rectangles itself,
+ * or plain memory stores when frame buffer is enabled.
+ */
+void GraphicDriver_FillRect(unsigned short x, unsigned short y, unsigned short width, unsigned short height, unsigned int color)
+{
+	if( (width == 0) || (height == 0) )
+	{
+		return;
+	}
+
+#if (GRAPHIC_DRIVER_STATS != 0)
+	GraphicDriver_CountCall(&Stats[Caller].Rects, (unsigned long)width * height);
+#endif
+	Display->Ops.FillRect(x, y, width, height, Display->Format->FromRgb565(color));
+}
+
+/**
+ * @brief Write horizontal run of pixels with individual colors
+ *
+ * @param x, y - leftmost pixel of the span
+ * @param length - number of pixels in colors array
+ * @param colors - R5 G6 B5 color data, one entry per pixel
+ */
+void GraphicDriver_WriteSpan(unsigned short x, unsigned short y, unsigned short length, const unsigned short *colors)
+{
+	if(length == 0)
+	{
+		return;
+	}
+
+#if (GRAPHIC_DRIVER_STATS != 0)
+	GraphicDriver_CountCall(&Stats[Caller].Spans, length);
+#endif
+
+	if(Display->Panel.PixelFormat == PIXEL_FORMAT_RGB565)
+	{
+		Display->Ops.WriteSpan(x, y, length, colors);
+		return;
+	}
+
+	//Converted chunk by chunk into one window
+	Display->Ops.SetWindow(x, y, x + length - 1, y);
+	GraphicDriver_WritePixels(colors, length);
+	Display->Ops.EndWindow();
+}
+
+/**
+ * @brief Draw pixels of one row where mask bit is set, e.g. one glyph row, others are left untouched
+ *
+ * @param x, y - leftmost pixel of the row
+ * @param width - number of pixels, up to 32
+ * @param mask - bit 0 is pixel at x, bit 1 pixel at x + 1 and so on
+ * @param color - R5 G6 B5 color data
+ */
+void GraphicDriver_DrawMask(unsigned short x, unsigned short y, unsigned short width, unsigned long mask, unsigned int color)
+{
+#if (GRAPHIC_DRIVER_STATS != 0)
+	unsigned long bits;
+	unsigned long pixels = 0;
+#endif
+
+	if( (width == 0) || (mask == 0) )
+	{
+		return;
+	}
+
+#if (GRAPHIC_DRIVER_STATS != 0)
+	//Set bits within width
+	for(bits = (width < 32) ? mask & ((1UL << width) - 1) : mask; bits != 0; bits &= bits - 1)
+	{
+		pixels++;
+	}
+	GraphicDriver_CountCall(&Stats[Caller].Masks, pixels);
+#endif
+	Display->Ops.DrawMask(x, y, width, mask, Display->Format->FromRgb565(color));
+}
+
+/**
+ * @brief Draw one pixel with one-pixel window
+ */
+void GraphicDriver_DrawPointWindow(unsigned short x, unsigned short y, unsigned int color)
+{
+	Display->Panel.SetWindow(x, y, x, y);
+	Display->Panel.WriteColor(color, 1);
+	Display->Panel.EndWindow();
+}
+
+/**
+ * @brief Drop pixel, driver has neither points nor windows
+ */
+void GraphicDriver_DrawPointNone(unsigned short x, unsigned short y, unsigned int color)
+{
+	(void)x;
+	(void)y;
+	(void)color;
+}
+
+/**
+ * @brief Read back replacement for driver without it
+ *
+ * @return always 0
+ */
+unsigned int GraphicDriver_GetPointNone(unsigned short x, unsigned short y)
+{
+	(void)x;
+	(void)y;
 	return 0;
 }
+
+/**
+ * @brief Read back span one pixel at a time
+ */
+void GraphicDriver_ReadSpanPoints(unsigned short x, unsigned short y, unsigned short length, void *pixels)
+{
+	unsigned short i;
+
+	for(i = 0; i < length; i++)
+	{
+		//Screen entry, so that rotation applies
+		Display->Format->Fill(pixels, i, 1, Display->Screen.GetPoint(x + i, y));
+	}
+}
+
+/**
+ * @brief Fill rectangle with one window and one burst of color data
+ */
+void GraphicDriver_FillRectWindow(unsigned short x, unsigned short y, unsigned short width, unsigned short height, unsigned int color)
+{
+	Display->Panel.SetWindow(x, y, x + width - 1, y + height - 1);
+	Display->Panel.WriteColor(color, (unsigned int)width * height);
+	Display->Panel.EndWindow();
+}
+
+/**
+ * @brief Write span with one window and one burst of pixel data
+ */
+void GraphicDriver_WriteSpanWindow(unsigned short x, unsigned short y, unsigned short length, const void *pixels)
+{
+	Display->Panel.SetWindow(x, y, x + length - 1, y);
+	Display->Panel.WritePixels(pixels, length);
+	Display->Panel.EndWindow();
+}
+
+/**
+ * @brief Draw masked row as one filled rectangle per run of set bits
+ */
+void GraphicDriver_DrawMaskRuns(unsigned short x, unsigned short y, unsigned short width, unsigned long mask, unsigned int color)
+{
+	unsigned short run;
+
+	if(width < 32)
+	{
+		mask &= (1UL << width) - 1;
+	}
+
+	while(mask != 0)
+	{
+		//Skip clear bits, then take run of set bits, both found with one bit scan
+		run = GraphicDriver_CountTrailingZeros(mask);
+		mask >>= run;
+		x += run;
+		run = GraphicDriver_CountTrailingZeros(~mask);
+		mask = (run < GRAPHIC_DRIVER_MASK_BITS) ? mask >> run : 0;
+
+		//Screen entry, so that rotation applies
+		Display->Screen.FillRect(x, y, run, 1, color);
+		x += run;
+	}
+}
+
+/**
+ * @brief Count clear bits below the lowest set bit
+ *
+ * @return GRAPHIC_DRIVER_MASK_BITS if no bit is set
+ */
+unsigned short GraphicDriver_CountTrailingZeros(unsigned long bits)
+{
+#if defined(__GNUC__)
+	return (bits != 0) ? (unsigned short)__builtin_ctzl(bits) : GRAPHIC_DRIVER_MASK_BITS;
+#else
+	unsigned short count = 0;
+
+	if(bits == 0)
+	{
+		return GRAPHIC_DRIVER_MASK_BITS;
+	}
+	if( (bits & 0xFFFFFFFFUL) == 0 )
+	{
+		//Two shifts, single one by 32 is undefined for 32-bit long
+		bits >>= 16;
+		bits >>= 16;
+		count += 32;
+	}
+	if( (bits & 0xFFFF) == 0 )
+	{
+		bits >>= 16;
+		count += 16;
+	}
+	if( (bits & 0xFF) == 0 )
+	{
+		bits >>= 8;
+		count += 8;
+	}
+	if( (bits & 0x0F) == 0 )
+	{
+		bits >>= 4;
+		count += 4;
+	}
+	if( (bits & 0x03) == 0 )
+	{
+		bits >>= 2;
+		count += 2;
+	}
+	if( (bits & 0x01) == 0 )
+	{
+		count += 1;
+	}
+	return count;
+#endif
+}
+
+/**
+ * @brief Open emulated window for driver without window support
+ */
+void GraphicDriver_SetWindowPoints(unsigned short x_start, unsigned short y_start, unsigned short x_end, unsigned short y_end)
+{
+	(void)y_end;
+	WindowXStart = x_start;
+	WindowXEnd = x_end;
+	WindowX = x_start;
+	WindowY = y_start;
+}
+
+/**
+ * @brief Stream pixels into emulated window, one point each
+ */
+void GraphicDriver_WritePixelsPoints(const void *pixels, unsigned int count)
+{
+	unsigned int i;
+
+	for(i = 0; i < count; i++)
+	{
+		Display->Panel.DrawPoint(WindowX, WindowY, Display->Format->Get(pixels, i));
+		if(WindowX++ >= WindowXEnd)
+		{
+			WindowX = WindowXStart;
+			WindowY++;
+		}
+	}
+}
+
+/**
+ * @brief Stream the same color into emulated window, one point each
+ */
+void GraphicDriver_WriteColorPoints(unsigned int color, unsigned int count)
+{
+	unsigned int i;
+
+	for(i = 0; i < count; i++)
+	{
+		Display->Panel.DrawPoint(WindowX, WindowY, color);
+		if(WindowX++ >= WindowXEnd)
+		{
+			WindowX = WindowXStart;
+			WindowY++;
+		}
+	}
+}
+
+/**
+ * @brief Close window of driver that needs no closing
+ */
+void GraphicDriver_EndWindowNone(void)
+{
+	do{}while(0);
+}
+
+/**
+ * @brief Set up Screen entries for current driver and rotation, and point drawing at them
+ */
+void GraphicDriver_SetScreen(void)
+{
+	const GRAPHIC_DRIVER_TYPE *display = &Display->Screen;
+
+	Display->Screen = Display->Panel;
+
+	if( (Display->Rotation == ROTATION_90) || (Display->Rotation == ROTATION_270) )
+	{
+		Display->Screen.Width = Display->Panel.Height;
+		Display->Screen.Height = Display->Panel.Width;
+	}
+
+	if( (Display->Rotation != ROTATION_0) && (Display->Panel.SetRotation == NULL) )
+	{
+		Display->Screen.DrawPoint = GraphicDriver_RotatedDrawPoint;
+		Display->Screen.GetPoint = GraphicDriver_RotatedGetPoint;
+		Display->Screen.ReadSpan = GraphicDriver_ReadSpanPoints;
+		Display->Screen.GetRow = NULL;
+		Display->Screen.FillRect = GraphicDriver_RotatedFillRect;
+		Display->Screen.WriteSpan = GraphicDriver_RotatedWriteSpan;
+		Display->Screen.DrawMask = GraphicDriver_DrawMaskRuns;
+		Display->Screen.SetWindow = GraphicDriver_RotatedSetWindow;
+		Display->Screen.WritePixels = GraphicDriver_RotatedWritePixels;
+		Display->Screen.WriteColor = GraphicDriver_RotatedWriteColor;
+		Display->Screen.EndWindow = GraphicDriver_EndWindowNone;
+		Display->Screen.WritePixelsAsync = NULL;
+	}
+
+#if (GRAPHIC_DRIVER_SHADOW != 0) || (GRAPHIC_DRIVER_FRAMEBUFFER != 0)
+	//Single shadow and frame buffer serve the display set up first
+	if(BufferedDisplay == NULL)
+	{
+		BufferedDisplay = Display;
+	}
+	if(BufferedDisplay != Display)
+	{
+		Display->Ops = *display;
+		return;
+	}
+#endif
+
+#if (GRAPHIC_DRIVER_SHADOW != 0)
+	//Shadow buffer mirrors Screen and takes its properties
+	ShadowBuffer_SetTarget(&Display->Screen);
+	Shadow = ShadowBuffer_Driver;
+	if(Display->Screen.WritePixelsAsync == NULL)
+	{
+		Shadow.WritePixelsAsync = NULL;
+	}
+	Shadow.Idle = Display->Screen.Idle;
+	Shadow.Width = Display->Screen.Width;
+	Shadow.Height = Display->Screen.Height;
+	Shadow.PixelFormat = Display->Screen.PixelFormat;
+	display = &Shadow;
+#endif
+
+#if (GRAPHIC_DRIVER_FRAMEBUFFER != 0)
+	FrameBuffer_SetTarget(display);
+	Display->Ops = FrameBuffer_Driver;
+#else
+	Display->Ops = *display;
+#endif
+}
+
+/**
+ * @brief Clip rectangle to the screen
+ *
+ * @return FALSE when nothing is left
+ */
+bool GraphicDriver_ClipRect(unsigned short *x, unsigned short *y, unsigned short *width, unsigned short *height)
+{
+	if( (*x >= Display->Screen.Width) || (*y >= Display->Screen.Height) || (*width == 0) || (*height == 0) )
+	{
+		return FALSE;
+	}
+	if(*width > Display->Screen.Width - *x)
+	{
+		*width = Display->Screen.Width - *x;
+	}
+	if(*height > Display->Screen.Height - *y)
+	{
+		*height = Display->Screen.Height - *y;
+	}
+	return TRUE;
+}
+
+/**
+ * @brief Transform rectangle inside of the screen into panel coordinates
+ */
+void GraphicDriver_RotateRect(unsigned short *x, unsigned short *y, unsigned short *width, unsigned short *height)
+{
+	unsigned short screen_x = *x, screen_y = *y, screen_width = *width, screen_height = *height;
+
+	switch(Display->Rotation)
+	{
+		case ROTATION_90:
+			*x = Display->Panel.Width - screen_y - screen_height;
+			*y = screen_x;
+			*width = screen_height;
+			*height = screen_width;
+			break;
+
+		case ROTATION_180:
+			*x = Display->Panel.Width - screen_x - screen_width;
+			*y = Display->Panel.Height - screen_y - screen_height;
+			break;
+
+		case ROTATION_270:
+			*x = screen_y;
+			*y = Display->Panel.Height - screen_x - screen_width;
+			*width = screen_height;
+			*height = screen_width;
+			break;
+
+		default:
+			break;
+	}
+}
+
+/**
+ * @brief Draw one pixel on rotated screen
+ */
+void GraphicDriver_RotatedDrawPoint(unsigned short x, unsigned short y, unsigned int color)
+{
+	unsigned short width = 1, height = 1;
+
+	if(GraphicDriver_ClipRect(&x, &y, &width, &height) == TRUE)
+	{
+		GraphicDriver_RotateRect(&x, &y, &width, &height);
+		Display->Panel.DrawPoint(x, y, color);
+	}
+}
+
+/**
+ * @brief Get color data of one pixel of rotated screen
+ */
+unsigned int GraphicDriver_RotatedGetPoint(unsigned short x, unsigned short y)
+{
+	unsigned short width = 1, height = 1;
+
+	if(GraphicDriver_ClipRect(&x, &y, &width, &height) == FALSE)
+	{
+		return 0;
+	}
+	GraphicDriver_RotateRect(&x, &y, &width, &height);
+	return Display->Panel.GetPoint(x, y);
+}
+
+/**
+ * @brief Fill rectangle of rotated screen, it is one rectangle on the panel too
+ */
+void GraphicDriver_RotatedFillRect(unsigned short x, unsigned short y, unsigned short width, unsigned short height, unsigned int color)
+{
+	if(GraphicDriver_ClipRect(&x, &y, &width, &height) == TRUE)
+	{
+		GraphicDriver_RotateRect(&x, &y, &width, &height);
+		Display->Panel.FillRect(x, y, width, height, color);
+	}
+}
+
+/**
+ * @brief Write span of rotated screen as one panel row or column
+ */
+void GraphicDriver_RotatedWriteSpan(unsigned short x, unsigned short y, unsigned short length, const void *pixels)
+{
+	GraphicDriver_RotatedWriteRun(x, y, length, pixels, 0);
+}
+
+/**
+ * @brief Write span of rotated screen taken from pixel data starting at pixels_x
+ *
+ * @details Span runs down the panel at 90 degrees, left at 180 and up at 270, so for the last two
+ * pixel data is streamed backwards through a small buffer. So is pixel data that does not start
+ * at byte boundary.
+ */
+void GraphicDriver_RotatedWriteRun(unsigned short x, unsigned short y, unsigned short length, const void *pixels, unsigned int pixels_x)
+{
+	unsigned short chunk[GRAPHIC_DRIVER_CHUNK_WORDS];
+	unsigned short height = 1, run, i;
+	unsigned int bit = pixels_x * Display->Format->BitsPerPixel;
+
+	if(GraphicDriver_ClipRect(&x, &y, &length, &height) == FALSE)
+	{
+		return;
+	}
+	GraphicDriver_RotateRect(&x, &y, &length, &height);
+
+	Display->Panel.SetWindow(x, y, x + length - 1, y + height - 1);
+
+	//Span is length pixels long in either orientation
+	length = (unsigned short)(length * height);
+	if( (Display->Rotation == ROTATION_90) && ( (bit & 0x07) == 0 ) )
+	{
+		Display->Panel.WritePixels((const unsigned char *)pixels + (bit >> 3), length);
+	}
+	else
+	{
+		while(length > 0)
+		{
+			run = (length < GRAPHIC_DRIVER_CHUNK_PIXELS) ? length : GRAPHIC_DRIVER_CHUNK_PIXELS;
+			if(Display->Rotation == ROTATION_90)
+			{
+				Display->Format->Copy(chunk, 0, pixels, pixels_x, run);
+				pixels_x += run;
+			}
+			else
+			{
+				for(i = 0; i < run; i++)
+				{
+					Display->Format->Fill(chunk, i, 1, Display->Format->Get(pixels, pixels_x + length - 1 - i));
+				}
+			}
+			Display->Panel.WritePixels(chunk, run);
+			length -= run;
+		}
+	}
+	Display->Panel.EndWindow();
+}
+
+/**
+ * @brief Open window of rotated screen, pixels streamed into it are written span by span
+ */
+void GraphicDriver_RotatedSetWindow(unsigned short x_start, unsigned short y_start, unsigned short x_end, unsigned short y_end)
+{
+	RotatedXStart = x_start;
+	RotatedXEnd = x_end;
+	RotatedYEnd = y_end;
+	RotatedX = x_start;
+	RotatedY = y_start;
+}
+
+/**
+ * @brief Stream pixels into window of rotated screen, one span per window row
+ */
+void GraphicDriver_RotatedWritePixels(const void *pixels, unsigned int count)
+{
+	unsigned int run, pixels_x = 0;
+
+	while( (count > 0) && (RotatedY <= RotatedYEnd) )
+	{
+		run = RotatedXEnd - RotatedX + 1;
+		if(run > count)
+		{
+			run = count;
+		}
+
+		GraphicDriver_RotatedWriteRun(RotatedX, RotatedY, (unsigned short)run, pixels, pixels_x);
+
+		pixels_x += run;
+		count -= run;
+		RotatedX += run;
+		if(RotatedX > RotatedXEnd)
+		{
+			RotatedX = RotatedXStart;
+			RotatedY++;
+		}
+	}
+}
+
+/**
+ * @brief Stream the same color into window of rotated screen
+ *
+ * @details Whole window rows are filled as one rectangle, partial rows as one span each
+ */
+void GraphicDriver_RotatedWriteColor(unsigned int color, unsigned int count)
+{
+	unsigned int run, rows;
+	unsigned int width = RotatedXEnd - RotatedXStart + 1;
+
+	while( (count > 0) && (RotatedY <= RotatedYEnd) )
+	{
+		if( (RotatedX == RotatedXStart) && (count >= width) )
+		{
+			rows = count / width;
+			if(rows > (unsigned int)RotatedYEnd - RotatedY + 1)
+			{
+				rows = RotatedYEnd - RotatedY + 1;
+			}
+			GraphicDriver_RotatedFillRect(RotatedXStart, RotatedY, (unsigned short)width, (unsigned short)rows, color);
+			count -= rows * width;
+			RotatedY += rows;
+			continue;
+		}
+
+		run = RotatedXEnd - RotatedX + 1;
+		if(run > count)
+		{
+			run = count;
+		}
+
+		GraphicDriver_RotatedFillRect(RotatedX, RotatedY, (unsigned short)run, 1, color);
+
+		count -= run;
+		RotatedX += run;
+		if(RotatedX > RotatedXEnd)
+		{
+			RotatedX = RotatedXStart;
+			RotatedY++;
+		}
+	}
+}
@@ -15,14 +15,215 @@
 #ifndef GRAPHICDRIVER_H_
 #define GRAPHICDRIVER_H_
 
-//! Horizontal resolution in pixel unit
-#define H_RES   320
+#include "../Typedefs.h"
+#include "PixelFormat.h"
 
-//! Vertical resolution in pixel unit
-#define V_RES   240
+//! Widest screen row in pixel unit that frame buffer has room for
+#ifndef GRAPHIC_DRIVER_MAX_WIDTH
+#define GRAPHIC_DRIVER_MAX_WIDTH	320
+#endif
 
-void GraphicDriver_Initialize(void);
+//! Tallest screen in pixel unit that frame buffer has room for
+#ifndef GRAPHIC_DRIVER_MAX_HEIGHT
+#define GRAPHIC_DRIVER_MAX_HEIGHT	240
+#endif
+
+//! Set to 1 to render into RAM frame buffer (GRAPHIC_DRIVER_MAX_WIDTH * GRAPHIC_DRIVER_MAX_HEIGHT * 2 bytes at 16 bits per pixel) and transfer it to LCD
+//! with GraphicDriver_Flush. GraphicDriver_Initialize then puts FrameBuffer module in front of
+//! the display driver. Set to 0 to send every drawing operation straight to display driver.
+#ifndef GRAPHIC_DRIVER_FRAMEBUFFER
+#define GRAPHIC_DRIVER_FRAMEBUFFER		0
+#endif
+
+//! Bits per pixel frame buffer storage is sized for: 16, or less to save RAM on display with smaller
+//! pixel format, e.g. 8 for PIXEL_FORMAT_INDEX8 or 1 for PIXEL_FORMAT_MONO1.
+#ifndef GRAPHIC_DRIVER_FRAMEBUFFER_BPP
+#define GRAPHIC_DRIVER_FRAMEBUFFER_BPP		16
+#endif
+
+//! Number of GRAPHIC_DRIVER_MAX_WIDTH pixel rows held in frame buffer. Set less than screen height, e.g. 16,
+//! to render the screen band by band with GRAPHIC_DRIVER_MAX_WIDTH * GRAPHIC_DRIVER_FRAMEBUFFER_LINES * 2 bytes
+//! of RAM. Narrower screen, e.g. rotated one, fits more rows.
+#ifndef GRAPHIC_DRIVER_FRAMEBUFFER_LINES
+#define GRAPHIC_DRIVER_FRAMEBUFFER_LINES	GRAPHIC_DRIVER_MAX_HEIGHT
+#endif
+
+//! Number of frame buffers, 1 or 2. With 2 buffers and display driver providing WritePixelsAsync the next
+//! frame is rendered while the previous one is transferred, at the cost of twice the frame buffer RAM.
+#ifndef GRAPHIC_DRIVER_FRAMEBUFFER_COUNT
+#define GRAPHIC_DRIVER_FRAMEBUFFER_COUNT	1
+#endif
+
+//! Set to 1 to keep RAM copy of the screen (GRAPHIC_DRIVER_MAX_WIDTH * GRAPHIC_DRIVER_MAX_HEIGHT * 2 bytes at 16 bits per pixel),
+//! so GraphicDriver_GetPoint and GraphicDriver_ReadRect are served from RAM instead of LCD read back.
+//! GraphicDriver_Initialize then puts ShadowBuffer module in front of the display driver.
+#ifndef GRAPHIC_DRIVER_SHADOW
+#define GRAPHIC_DRIVER_SHADOW			0
+#endif
+
+//! Bits per pixel shadow storage is sized for, like GRAPHIC_DRIVER_FRAMEBUFFER_BPP
+#ifndef GRAPHIC_DRIVER_SHADOW_BPP
+#define GRAPHIC_DRIVER_SHADOW_BPP		16
+#endif
+
+//! Set to 1 to count drawing calls, windows, pixels and pixel data bytes, per frame and cumulative,
+//! broken down by caller. Set to 0 to compile counting out, statistics functions are then empty macros.
+#ifndef GRAPHIC_DRIVER_STATS
+#define GRAPHIC_DRIVER_STATS			0
+#endif
+
+//! Set to 1 to pace flushes with LCD tearing effect (TE) signal, so frame buffer content is sent just
+//! behind the scanline and never overtaken by it. GraphicDriver_VSync has to be called on every TE pulse,
+//! i.e. at the start of vertical blanking, e.g. from TE line interrupt. Takes effect with frame buffer only.
+#ifndef GRAPHIC_DRIVER_VSYNC
+#define GRAPHIC_DRIVER_VSYNC			0
+#endif
+
+//! Panel refresh rate in Hz, i.e. TE pulses per second, used to compute achieved frame rate
+#ifndef GRAPHIC_DRIVER_VSYNC_HZ
+#define GRAPHIC_DRIVER_VSYNC_HZ			60
+#endif
+
+//! Flush completion callback type
+typedef void (* GRAPHIC_DRIVER_CALLBACK_TYPE)(void);
+
+//! Display rotation, clockwise
+typedef enum
+{
+	ROTATION_0 = 0,
+	ROTATION_90,
+	ROTATION_180,
+	ROTATION_270
+} GRAPHIC_DRIVER_ROTATION_TYPE;
+
+//! Callers drawing is counted for, set with GraphicDriver_BeginCaller
+typedef enum
+{
+	CALLER_OTHER = 0,
+	CALLER_PANEL,
+	CALLER_LABEL,
+	CALLER_BUTTON,
+	CALLER_SLIDER,
+	CALLER_CHECKBOX,
+	CALLER_LED,
+	CALLER_TEXTBOX,
+	CALLER_GRAPH,
+	CALLER_COUNT
+} GRAPHIC_DRIVER_CALLER_TYPE;
+
+//! Drawing statistics of one caller
+typedef struct
+{
+	unsigned long Points;		//!< GraphicDriver_DrawPoint calls
+	unsigned long Rects;		//!< GraphicDriver_FillRect calls, lines included
+	unsigned long Spans;		//!< GraphicDriver_WriteSpan calls
+	unsigned long Masks;		//!< GraphicDriver_DrawMask calls
+	unsigned long Windows;		//!< GraphicDriver_BeginWindow calls
+	unsigned long Pixels;		//!< Pixels drawn
+	unsigned long Bytes;		//!< Pixel data bytes of pixels drawn, in display pixel format
+} GRAPHIC_DRIVER_STATS_TYPE;
+
+//! Presentation statistics with GRAPHIC_DRIVER_VSYNC enabled
+typedef struct
+{
+	unsigned long VSyncs;		//!< TE pulses
+	unsigned long Frames;		//!< Frames presented, at most one per TE pulse
+	unsigned long Missed;		//!< Frames whose transfer did not finish before next TE pulse
+	unsigned short FrameRate;	//!< Achieved frames per second, Frames * GRAPHIC_DRIVER_VSYNC_HZ / VSyncs
+} GRAPHIC_DRIVER_VSYNC_STATS_TYPE;
+
+//! Display driver descriptor. Every entry is optional, NULL marks missing capability.
+//! GraphicDriver module replaces missing drawing entries with the fastest available ones.
+//! Colors and pixel data passed to the entries are in driver PixelFormat, pixel data is packed.
+typedef struct
+{
+	void (* Initialize)(void);			//!< Initialize display and enable it
+	void (* DrawPoint)(unsigned short x, unsigned short y, unsigned int color);	//!< Draw one pixel
+	unsigned int (* GetPoint)(unsigned short x, unsigned short y);				//!< Read back one pixel
+	void (* ReadSpan)(unsigned short x, unsigned short y, unsigned short length, void *pixels);	//!< Read back horizontal run of pixels
+	const void* (* GetRow)(unsigned short y);	//!< Get pixel data of screen row kept in RAM, NULL when row is not kept
+	void (* FillRect)(unsigned short x, unsigned short y, unsigned short width, unsigned short height, unsigned int color);	//!< Fill rectangle
+	void (* WriteSpan)(unsigned short x, unsigned short y, unsigned short length, const void *pixels);			//!< Write horizontal run of pixels
+	void (* DrawMask)(unsigned short x, unsigned short y, unsigned short width, unsigned long mask, unsigned int color);	//!< Draw pixels of a row where mask bit is set, bit 0 at x
+	void (* SetWindow)(unsigned short x_start, unsigned short y_start, unsigned short x_end, unsigned short y_end);		//!< Open window, ends inclusive. Requires WritePixels and WriteColor.
+	void (* WritePixels)(const void *pixels, unsigned int count);		//!< Stream pixels into window
+	void (* WriteColor)(unsigned int color, unsigned int count);				//!< Stream one color into window
+	void (* EndWindow)(void);			//!< Close window
+	void (* WritePixelsAsync)(const void *pixels, unsigned int count);	//!< Start DMA stream into window, completion is reported with GraphicDriver_TransferComplete
+	void (* Idle)(void);				//!< Called while waiting for DMA stream to finish
+	void (* Flush)(void);				//!< Transfer buffered drawing and wait until it has finished
+	void (* FlushAsync)(GRAPHIC_DRIVER_CALLBACK_TYPE done);	//!< Start transfer of buffered drawing
+	void (* SetBand)(unsigned short y);	//!< Place band of GetBandHeight rows at defined screen row
+	bool (* GetDamagedRows)(unsigned short *y_start, unsigned short *y_end);	//!< Get rows drawn since last call
+	unsigned short (* GetBandHeight)(void);	//!< Get rows rendered at once
+	void (* SetRotation)(GRAPHIC_DRIVER_ROTATION_TYPE rotation);	//!< Rotate in hardware, e.g. with memory access control
+	unsigned short Width;				//!< Horizontal resolution in pixel unit, unrotated
+	unsigned short Height;				//!< Vertical resolution in pixel unit, unrotated
+	PIXEL_FORMAT_TYPE PixelFormat;		//!< Format of colors and pixel data
+} GRAPHIC_DRIVER_TYPE;
+
+//! Display instance, state of one display kept by GraphicDriver module. Has to be zero initialized,
+//! e.g. static, before it is selected with GraphicDriver_SelectDisplay and given a driver.
+typedef struct
+{
+	const GRAPHIC_DRIVER_TYPE *Driver;		//!< Driver selected with GraphicDriver_SetDriver
+	GRAPHIC_DRIVER_TYPE Panel;				//!< Driver entries, missing ones replaced
+	GRAPHIC_DRIVER_TYPE Screen;				//!< Panel entries seen through rotation, in screen coordinates
+	GRAPHIC_DRIVER_TYPE Ops;				//!< Entries drawing goes through, Screen, shadow or frame buffer
+	GRAPHIC_DRIVER_ROTATION_TYPE Rotation;	//!< Current display rotation
+	const PIXEL_FORMAT_KERNELS_TYPE *Format;	//!< Kernels of driver pixel format
+} GRAPHIC_DRIVER_DISPLAY_TYPE;
+
+void GraphicDriver_Initialize(const GRAPHIC_DRIVER_TYPE *driver);
+void GraphicDriver_SetDriver(const GRAPHIC_DRIVER_TYPE *driver);
+const GRAPHIC_DRIVER_TYPE* GraphicDriver_GetDriver(void);
+GRAPHIC_DRIVER_DISPLAY_TYPE* GraphicDriver_SelectDisplay(GRAPHIC_DRIVER_DISPLAY_TYPE *display);
+GRAPHIC_DRIVER_DISPLAY_TYPE* GraphicDriver_GetDisplay(void);
+void GraphicDriver_SetRotation(GRAPHIC_DRIVER_ROTATION_TYPE rotation);
+GRAPHIC_DRIVER_ROTATION_TYPE GraphicDriver_GetRotation(void);
+unsigned short GraphicDriver_GetWidth(void);
+unsigned short GraphicDriver_GetHeight(void);
+unsigned short GraphicDriver_GetPanelWidth(void);
+unsigned short GraphicDriver_GetPanelHeight(void);
+const PIXEL_FORMAT_KERNELS_TYPE* GraphicDriver_GetPixelFormat(void);
+void GraphicDriver_PanelToScreen(unsigned short panel_x, unsigned short panel_y, unsigned short *x, unsigned short *y);
 void GraphicDriver_DrawPoint(unsigned short x, unsigned short y, unsigned int color);
 unsigned int GraphicDriver_GetPoint(unsigned short x, unsigned short y);
+void GraphicDriver_ReadRect(unsigned short x, unsigned short y, unsigned short width, unsigned short height, unsigned short *colors);
+void GraphicDriver_DrawHLine(unsigned short x, unsigned short y, unsigned short length, unsigned int color);
+void GraphicDriver_DrawVLine(unsigned short x, unsigned short y, unsigned short length, unsigned int color);
+void GraphicDriver_FillRect(unsigned short x, unsigned short y, unsigned short width, unsigned short height, unsigned int color);
+void GraphicDriver_WriteSpan(unsigned short x, unsigned short y, unsigned short length, const unsigned short *colors);
+void GraphicDriver_DrawMask(unsigned short x, unsigned short y, unsigned short width, unsigned long mask, unsigned int color);
+void GraphicDriver_BeginWindow(unsigned short x_start, unsigned short y_start, unsigned short x_end, unsigned short y_end);
+void GraphicDriver_PushPixels(const unsigned short *pixels, unsigned int count);
+void GraphicDriver_PushNative(const void *pixels, unsigned int count);
+void GraphicDriver_PushColor(unsigned int color, unsigned int count);
+void GraphicDriver_EndWindow(void);
+void GraphicDriver_Flush(void);
+void GraphicDriver_FlushAsync(GRAPHIC_DRIVER_CALLBACK_TYPE done);
+void GraphicDriver_TransferComplete(void);
+unsigned short GraphicDriver_GetBandHeight(void);
+void GraphicDriver_SetBand(unsigned short y);
+bool GraphicDriver_GetDamagedRows(unsigned short *y_start, unsigned short *y_end);
+#if (GRAPHIC_DRIVER_VSYNC != 0)
+void GraphicDriver_VSync(void);
+GRAPHIC_DRIVER_VSYNC_STATS_TYPE GraphicDriver_GetVSyncStats(void);
+void GraphicDriver_ResetVSyncStats(void);
+#endif
+#if (GRAPHIC_DRIVER_STATS != 0)
+void GraphicDriver_BeginCaller(GRAPHIC_DRIVER_CALLER_TYPE caller);
+void GraphicDriver_EndCaller(void);
+void GraphicDriver_EndFrame(void);
+void GraphicDriver_ResetStats(void);
+GRAPHIC_DRIVER_STATS_TYPE GraphicDriver_GetFrameStats(GRAPHIC_DRIVER_CALLER_TYPE caller);
+GRAPHIC_DRIVER_STATS_TYPE GraphicDriver_GetTotalStats(GRAPHIC_DRIVER_CALLER_TYPE caller);
+unsigned long GraphicDriver_GetFrameCount(void);
+#else
+#define GraphicDriver_BeginCaller(caller)	do{ (void)(caller); }while(0)
+#define GraphicDriver_EndCaller()			do{}while(0)
+#define GraphicDriver_EndFrame()			do{}while(0)
+#define GraphicDriver_ResetStats()			do{}while(0)
+#endif
 
 #endif /* GRAPHICDRIVER_H_ */
@@ -0,0 +1,533 @@
+/**
+ * @file LcdHost.c
+ *
+ * @brief Host stand-in for LcdPort module, LcdHost_Driver display driver
+ *
+ * @details Models LCD controller with column/row window addressing (column address set, page
+ * address set and memory write commands) on a byte-wide bus. Pixel data is kept in a memory array
+ * so it can be read back, and every byte that would be sent over the bus is counted. Pixel data
+ * comes in LCD_HOST_PIXEL_FORMAT, packed pixel data of a burst is rounded up to whole bytes.
+ * Pass LcdHost_Driver to GraphicDriver_Initialize to use it instead of LcdPort_Driver.
+ *
+ * Bus traffic can be broken down by named sections, e.g. with Gui_SetDrawHook(LcdHost_Section) per
+ * Gui drawing function, and graphic memory can be dumped to PPM image for visual regression tests.
+ *
+ * With LCD_HOST_BYTE_TIME_NS set every bus write busy-waits for the time the bytes would take on the bus.
+ * With LCD_HOST_ASYNC_SUPPORT enabled LcdHost_WritePixelsAsync hands pixel data to a worker thread that
+ * plays the DMA controller: it sleeps for the transfer time, stores the pixels and calls
+ * GraphicDriver_TransferComplete. Link with pthread library in that case.
+ *
+ * With GRAPHIC_DRIVER_VSYNC enabled a timer thread stands in for the TE line: it calls GraphicDriver_VSync
+ * GRAPHIC_DRIVER_VSYNC_HZ times per second. Link with pthread library in that case too.
+ *
+ * @author Krzysztof Grzeszczak
+ *
+ * @version 1.0
+ *
+ * @date 2012-2013
+ *
+ * @copyright GNU Public License
+ */
+
+#define _POSIX_C_SOURCE 200112L
+
+#include "LcdHost.h"
+#include <stddef.h>
+#include <stdio.h>
+#include <time.h>
+#if (LCD_HOST_ASYNC_SUPPORT != 0) || (GRAPHIC_DRIVER_VSYNC != 0)
+#include <pthread.h>
+#endif
+#if (LCD_HOST_ASYNC_SUPPORT != 0)
+#include <sched.h>
+#endif
+
+//! Bus bytes of window setup: column address set, page address set and memory write commands
+#define LCD_HOST_WINDOW_BYTES	(3 * LCD_HOST_COMMAND_BYTES + 2 * LCD_HOST_ADDRESS_BYTES)
+
+static unsigned int Gram[LCD_HOST_HEIGHT][LCD_HOST_WIDTH];		//!< LCD controller graphic memory, native pixel values
+static const PIXEL_FORMAT_KERNELS_TYPE *Format;	//!< Kernels of LCD_HOST_PIXEL_FORMAT
+static LCD_HOST_COUNTERS_TYPE Counters;			//!< Bus traffic counters
+static LCD_HOST_COUNTERS_TYPE SectionMark;		//!< Counters when current section was last charged
+static LCD_HOST_SECTION_TYPE Sections[LCD_HOST_MAX_SECTIONS + 1];	//!< Traffic of named sections, overflow entry last
+static unsigned char SectionCount;				//!< Valid entries in Sections
+static unsigned char SectionStack[LCD_HOST_SECTION_DEPTH];		//!< Sections entered, innermost last
+static unsigned char SectionDepth;				//!< Entries in SectionStack, deeper sections are not tracked
+static unsigned short WindowXStart;				//!< Leftmost column of current window
+static unsigned short WindowXEnd;				//!< Rightmost column of current window
+static unsigned short WindowYEnd;				//!< Bottom row of current window
+static unsigned short WindowX;					//!< Column of next pixel in current window
+static unsigned short WindowY;					//!< Row of next pixel in current window
+#if (LCD_HOST_ASYNC_SUPPORT != 0)
+static pthread_t DmaThread;						//!< Worker thread playing DMA controller
+static pthread_mutex_t DmaMutex = PTHREAD_MUTEX_INITIALIZER;	//!< Guards DmaPixels and DmaCount
+static pthread_cond_t DmaCond = PTHREAD_COND_INITIALIZER;		//!< Signals new DMA request
+static const void *DmaPixels;			//!< Pixel data of pending DMA request
+static unsigned int DmaCount;					//!< Pixels of pending DMA request, 0 when none
+static bool IsDmaStarted = FALSE;				//!< TRUE once worker thread is running
+#endif
+#if (GRAPHIC_DRIVER_VSYNC != 0)
+static pthread_t VSyncThread;					//!< Timer thread playing TE line
+static bool IsVSyncStarted = FALSE;				//!< TRUE once timer thread is running
+#endif
+
+static void LcdHost_Initialize(void);
+static void LcdHost_DrawPoint(unsigned short x, unsigned short y, unsigned int color);
+static void LcdHost_SetWindow(unsigned short x_start, unsigned short y_start, unsigned short x_end, unsigned short y_end);
+static void LcdHost_WritePixels(const void *pixels, unsigned int count);
+static void LcdHost_WriteColor(unsigned int color, unsigned int count);
+static void LcdHost_EndWindow(void);
+static void LcdHost_WritePixel(unsigned int pixel);
+static void LcdHost_AddPixelBytes(unsigned int count);
+static void LcdHost_Delay(unsigned long bytes);
+static void LcdHost_ChargeSection(void);
+#if (LCD_HOST_ASYNC_SUPPORT != 0)
+static void LcdHost_WritePixelsAsync(const void *pixels, unsigned int count);
+static void LcdHost_Idle(void);
+static void LcdHost_Sleep(unsigned long bytes);
+static void* LcdHost_DmaTask(void *arg);
+#endif
+#if (GRAPHIC_DRIVER_VSYNC != 0)
+static void* LcdHost_VSyncTask(void *arg);
+#endif
+
+//! LcdHost module driver descriptor
+const GRAPHIC_DRIVER_TYPE LcdHost_Driver =
+{
+	LcdHost_Initialize,
+	LcdHost_DrawPoint,
+	LcdHost_GetPoint,
+	NULL,						//ReadSpan, pixel by pixel read back is used
+	NULL,						//GetRow
+	NULL,						//FillRect, window stream is used
+	NULL,						//WriteSpan, window stream is used
+	NULL,						//DrawMask, filled runs are used
+	LcdHost_SetWindow,
+	LcdHost_WritePixels,
+	LcdHost_WriteColor,
+	LcdHost_EndWindow,
+#if (LCD_HOST_ASYNC_SUPPORT != 0)
+	LcdHost_WritePixelsAsync,
+	LcdHost_Idle,
+#else
+	NULL,
+	NULL,
+#endif
+	NULL,						//Flush, nothing is buffered
+	NULL,						//FlushAsync
+	NULL,						//SetBand
+	NULL,						//GetDamagedRows
+	NULL,						//GetBandHeight
+	NULL,						//SetRotation
+	LCD_HOST_WIDTH,
+	LCD_HOST_HEIGHT,
+	LCD_HOST_PIXEL_FORMAT
+};
+
+/**
+ * @brief Initialize host LCD, clear graphic memory and counters
+ */
+void LcdHost_Initialize(void)
+{
+	unsigned short x, y;
+
+	Format = PixelFormat_GetKernels(LCD_HOST_PIXEL_FORMAT);
+	for(y = 0; y < LCD_HOST_HEIGHT; y++)
+	{
+		for(x = 0; x < LCD_HOST_WIDTH; x++)
+		{
+			Gram[y][x] = 0x0000;
+		}
+	}
+	LcdHost_ResetCounters();
+
+#if (LCD_HOST_ASYNC_SUPPORT != 0)
+	if(IsDmaStarted == FALSE)
+	{
+		pthread_create(&DmaThread, NULL, LcdHost_DmaTask, NULL);
+		IsDmaStarted = TRUE;
+	}
+#endif
+#if (GRAPHIC_DRIVER_VSYNC != 0)
+	if(IsVSyncStarted == FALSE)
+	{
+		pthread_create(&VSyncThread, NULL, LcdHost_VSyncTask, NULL);
+		IsVSyncStarted = TRUE;
+	}
+#endif
+}
+
+/**
+ * @brief Draw one pixel, costs one window setup and one pixel of data
+ */
+void LcdHost_DrawPoint(unsigned short x, unsigned short y, unsigned int color)
+{
+	LcdHost_SetWindow(x, y, x, y);
+	LcdHost_WritePixel(color);
+	LcdHost_AddPixelBytes(1);
+	Counters.Points++;
+}
+
+/**
+ * @brief Get native pixel value from host graphic memory
+ */
+unsigned int LcdHost_GetPoint(unsigned short x, unsigned short y)
+{
+	if( (x >= LCD_HOST_WIDTH) || (y >= LCD_HOST_HEIGHT) )
+	{
+		return 0;
+	}
+	Counters.Reads++;
+	return Gram[y][x];
+}
+
+/**
+ * @brief Set column/row window, both ends inclusive
+ */
+void LcdHost_SetWindow(unsigned short x_start, unsigned short y_start, unsigned short x_end, unsigned short y_end)
+{
+	WindowXStart = x_start;
+	WindowXEnd = x_end;
+	WindowYEnd = y_end;
+	WindowX = x_start;
+	WindowY = y_start;
+
+	Counters.Windows++;
+	Counters.BytesWritten += LCD_HOST_WINDOW_BYTES;
+	LcdHost_Delay(LCD_HOST_WINDOW_BYTES);
+}
+
+/**
+ * @brief Write run of pixel data into current window
+ */
+void LcdHost_WritePixels(const void *pixels, unsigned int count)
+{
+	unsigned int i;
+
+	for(i = 0; i < count; i++)
+	{
+		LcdHost_WritePixel(Format->Get(pixels, i));
+	}
+	LcdHost_AddPixelBytes(count);
+}
+
+/**
+ * @brief Write the same color count times into current window
+ */
+void LcdHost_WriteColor(unsigned int color, unsigned int count)
+{
+	unsigned int i;
+
+	for(i = 0; i < count; i++)
+	{
+		LcdHost_WritePixel(color);
+	}
+	LcdHost_AddPixelBytes(count);
+}
+
+/**
+ * @brief Finish pixel data transfer into window
+ */
+void LcdHost_EndWindow(void)
+{
+	do{}while(0);
+}
+
+/**
+ * @brief Reset bus traffic counters, section counters included
+ */
+void LcdHost_ResetCounters(void)
+{
+	Counters.BytesWritten = 0;
+	Counters.Windows = 0;
+	Counters.Points = 0;
+	Counters.Pixels = 0;
+	Counters.DmaTransfers = 0;
+	Counters.Reads = 0;
+	SectionMark = Counters;
+	SectionCount = 0;
+	SectionDepth = 0;
+}
+
+/**
+ * @brief Get bus traffic counters accumulated since last reset
+ *
+ * @return LCD_HOST_COUNTERS_TYPE copy of counters
+ */
+LCD_HOST_COUNTERS_TYPE LcdHost_GetCounters(void)
+{
+	return Counters;
+}
+
+/**
+ * @brief Enter or leave named section, traffic in between is counted for it
+ *
+ * @details Sections nest, traffic is counted for the innermost one. Signature matches
+ * GUI_DRAW_HOOK_TYPE, so Gui_SetDrawHook(LcdHost_Section) breaks traffic down by Gui drawing function.
+ *
+ * @param name - section entered, compared by pointer, or NULL to leave the innermost section
+ *
+ * @note Traffic of DMA transfer is counted for the section running when it finishes
+ */
+void LcdHost_Section(const char *name)
+{
+	unsigned char i;
+
+	LcdHost_ChargeSection();
+
+	if(name == NULL)
+	{
+		if(SectionDepth > 0)
+		{
+			SectionDepth--;
+		}
+		return;
+	}
+
+	i = 0;
+	while( (i < SectionCount) && (i < LCD_HOST_MAX_SECTIONS) && (Sections[i].Name != name) )
+	{
+		i++;
+	}
+	if(i == SectionCount)
+	{
+		//Sections that do not fit into the table are counted together in overflow entry
+		Sections[i].Name = (i == LCD_HOST_MAX_SECTIONS) ? LCD_HOST_OVERFLOW_SECTION : name;
+		Sections[i].Calls = 0;
+		Sections[i].Counters = (LCD_HOST_COUNTERS_TYPE){0};
+		SectionCount++;
+	}
+	Sections[i].Calls++;
+
+	if(SectionDepth < LCD_HOST_SECTION_DEPTH)
+	{
+		SectionStack[SectionDepth] = i;
+	}
+	SectionDepth++;
+}
+
+/**
+ * @brief Get bus traffic of sections entered since last counters reset
+ *
+ * @param count - number of returned sections
+ * @return array of sections, in order of first entry. Once more than LCD_HOST_MAX_SECTIONS sections
+ * are entered, the remaining ones are counted together in entry LCD_HOST_MAX_SECTIONS, named
+ * LCD_HOST_OVERFLOW_SECTION.
+ */
+const LCD_HOST_SECTION_TYPE* LcdHost_GetSections(unsigned char *count)
+{
+	LcdHost_ChargeSection();
+	*count = SectionCount;
+	return Sections;
+}
+
+/**
+ * @brief Write graphic memory to binary PPM image, 8 bits per color channel
+ *
+ * @return TRUE on success, FALSE when file can not be written
+ */
+bool LcdHost_DumpPpm(const char *path)
+{
+	const PIXEL_FORMAT_KERNELS_TYPE *format = PixelFormat_GetKernels(LCD_HOST_PIXEL_FORMAT);
+	unsigned char row[LCD_HOST_WIDTH * 3];
+	unsigned int color;
+	unsigned short x, y;
+	FILE *file;
+
+	file = fopen(path, "wb");
+	if(file == NULL)
+	{
+		return FALSE;
+	}
+
+	fprintf(file, "P6\n%u %u\n255\n", LCD_HOST_WIDTH, LCD_HOST_HEIGHT);
+	for(y = 0; y < LCD_HOST_HEIGHT; y++)
+	{
+		for(x = 0; x < LCD_HOST_WIDTH; x++)
+		{
+			//Expand R5 G6 B5 to full 8-bit range
+			color = format->ToRgb565(Gram[y][x]);
+			row[3 * x] = (unsigned char)(((color >> 11) & 0x1F) * 255 / 31);
+			row[3 * x + 1] = (unsigned char)(((color >> 5) & 0x3F) * 255 / 63);
+			row[3 * x + 2] = (unsigned char)((color & 0x1F) * 255 / 31);
+		}
+		fwrite(row, 1, sizeof(row), file);
+	}
+
+	return (fclose(file) == 0) ? TRUE : FALSE;
+}
+
+/**
+ * @brief Add traffic since last call to innermost tracked section
+ */
+void LcdHost_ChargeSection(void)
+{
+	LCD_HOST_COUNTERS_TYPE *section;
+
+	if( (SectionDepth > 0) && (SectionDepth <= LCD_HOST_SECTION_DEPTH) )
+	{
+		section = &Sections[SectionStack[SectionDepth - 1]].Counters;
+		section->BytesWritten += Counters.BytesWritten - SectionMark.BytesWritten;
+		section->Windows += Counters.Windows - SectionMark.Windows;
+		section->Points += Counters.Points - SectionMark.Points;
+		section->Pixels += Counters.Pixels - SectionMark.Pixels;
+		section->DmaTransfers += Counters.DmaTransfers - SectionMark.DmaTransfers;
+		section->Reads += Counters.Reads - SectionMark.Reads;
+	}
+	SectionMark = Counters;
+}
+
+/**
+ * @brief Store one pixel at window cursor and advance it like LCD controller does
+ *
+ * @note Pixels outside of the screen are counted but not stored
+ */
+void LcdHost_WritePixel(unsigned int pixel)
+{
+	if( (WindowX < LCD_HOST_WIDTH) && (WindowY < LCD_HOST_HEIGHT) && (WindowY <= WindowYEnd) )
+	{
+		Gram[WindowY][WindowX] = pixel;
+	}
+
+	if(WindowX++ >= WindowXEnd)
+	{
+		WindowX = WindowXStart;
+		WindowY++;
+	}
+
+	Counters.Pixels++;
+}
+
+/**
+ * @brief Count and wait for bus bytes of count pixels of one burst
+ */
+void LcdHost_AddPixelBytes(unsigned int count)
+{
+	unsigned long bytes = PixelFormat_GetBytes(Format, count);
+
+	Counters.BytesWritten += bytes;
+	LcdHost_Delay(bytes);
+}
+
+/**
+ * @brief Busy-wait for the time bytes would take on the bus, LCD_HOST_BYTE_TIME_NS each
+ */
+void LcdHost_Delay(unsigned long bytes)
+{
+	struct timespec now, end;
+
+	if(LCD_HOST_BYTE_TIME_NS == 0)
+	{
+		return;
+	}
+
+	clock_gettime(CLOCK_MONOTONIC, &end);
+	end.tv_nsec += (long)(bytes * LCD_HOST_BYTE_TIME_NS % 1000000000UL);
+	end.tv_sec += (time_t)(bytes * LCD_HOST_BYTE_TIME_NS / 1000000000UL) + end.tv_nsec / 1000000000L;
+	end.tv_nsec %= 1000000000L;
+
+	do
+	{
+		clock_gettime(CLOCK_MONOTONIC, &now);
+	} while( (now.tv_sec < end.tv_sec) || ( (now.tv_sec == end.tv_sec) && (now.tv_nsec < end.tv_nsec) ) );
+}
+
+#if (LCD_HOST_ASYNC_SUPPORT != 0)
+/**
+ * @brief Hand run of pixel data to DMA worker thread and return
+ */
+void LcdHost_WritePixelsAsync(const void *pixels, unsigned int count)
+{
+	pthread_mutex_lock(&DmaMutex);
+	DmaPixels = pixels;
+	DmaCount = count;
+	pthread_cond_signal(&DmaCond);
+	pthread_mutex_unlock(&DmaMutex);
+}
+
+/**
+ * @brief Give CPU to DMA worker thread while waiting for transfer to finish
+ */
+void LcdHost_Idle(void)
+{
+	sched_yield();
+}
+
+/**
+ * @brief Sleep for the time bytes would take on the bus, LCD_HOST_BYTE_TIME_NS each
+ */
+void LcdHost_Sleep(unsigned long bytes)
+{
+	struct timespec duration;
+
+	duration.tv_sec = (time_t)(bytes * LCD_HOST_BYTE_TIME_NS / 1000000000UL);
+	duration.tv_nsec = (long)(bytes * LCD_HOST_BYTE_TIME_NS % 1000000000UL);
+	if( (duration.tv_sec > 0) || (duration.tv_nsec > 0) )
+	{
+		nanosleep(&duration, NULL);
+	}
+}
+
+/**
+ * @brief DMA worker thread, transfers one request at a time and signals completion like DMA interrupt does
+ */
+void* LcdHost_DmaTask(void *arg)
+{
+	const void *pixels;
+	unsigned int count, i;
+
+	for(;;)
+	{
+		pthread_mutex_lock(&DmaMutex);
+		while(DmaCount == 0)
+		{
+			pthread_cond_wait(&DmaCond, &DmaMutex);
+		}
+		pixels = DmaPixels;
+		count = DmaCount;
+		DmaCount = 0;
+		pthread_mutex_unlock(&DmaMutex);
+
+		//DMA leaves CPU free, so sleep through transfer time instead of busy-waiting
+		LcdHost_Sleep(PixelFormat_GetBytes(Format, count));
+		for(i = 0; i < count; i++)
+		{
+			LcdHost_WritePixel(Format->Get(pixels, i));
+		}
+		Counters.BytesWritten += PixelFormat_GetBytes(Format, count);
+		Counters.DmaTransfers++;
+
+		//Completion handler may queue the next request
+		GraphicDriver_TransferComplete();
+	}
+
+	return arg;
+}
+#endif
+
+#if (GRAPHIC_DRIVER_VSYNC != 0)
+/**
+ * @brief TE timer thread, signals start of vertical blanking GRAPHIC_DRIVER_VSYNC_HZ times per second like TE line interrupt does
+ */
+void* LcdHost_VSyncTask(void *arg)
+{
+	struct timespec next;
+
+	clock_gettime(CLOCK_MONOTONIC, &next);
+	for(;;)
+	{
+		//Absolute deadlines, so the period does not drift with handler time
+		next.tv_nsec += 1000000000L / GRAPHIC_DRIVER_VSYNC_HZ;
+		if(next.tv_nsec >= 1000000000L)
+		{
+			next.tv_nsec -= 1000000000L;
+			next.tv_sec++;
+		}
+		clock_nanosleep(CLOCK_MONOTONIC, TIMER_ABSTIME, &next, NULL);
+
+		GraphicDriver_VSync();
+	}
+
+	return arg;
+}
+#endif
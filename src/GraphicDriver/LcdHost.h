@@ -0,0 +1,91 @@
+/**
+ * @file LcdHost.h
+ *
+ * @brief LcdHost module API. Host stand-in for LcdPort module.
+ *
+ * @author Krzysztof Grzeszczak
+ *
+ * @version 1.0
+ *
+ * @date 2012-2013
+ *
+ * @copyright GNU Public License
+ */
+
+#ifndef LCDHOST_H_
+#define LCDHOST_H_
+
+#include "GraphicDriver.h"
+
+//! Set to 1 to provide WritePixelsAsync, served by a worker thread playing DMA controller.
+//! Requires pthread library.
+#ifndef LCD_HOST_ASYNC_SUPPORT
+#define LCD_HOST_ASYNC_SUPPORT		0
+#endif
+
+//! Horizontal resolution of host LCD in pixel unit
+#ifndef LCD_HOST_WIDTH
+#define LCD_HOST_WIDTH				320
+#endif
+
+//! Vertical resolution of host LCD in pixel unit
+#ifndef LCD_HOST_HEIGHT
+#define LCD_HOST_HEIGHT				240
+#endif
+
+//! Bus bytes of one command (command byte) sent to LCD controller
+#define LCD_HOST_COMMAND_BYTES		1
+
+//! Bus bytes of column or page address set parameters (start and end, 16-bit each)
+#define LCD_HOST_ADDRESS_BYTES		4
+
+//! Pixel format of host LCD, PIXEL_FORMAT_TYPE. Pixel bytes on the bus follow from it.
+#ifndef LCD_HOST_PIXEL_FORMAT
+#define LCD_HOST_PIXEL_FORMAT		PIXEL_FORMAT_RGB565
+#endif
+
+//! Simulated bus time of one byte in nanoseconds, e.g. 200 for 40 MHz SPI. 0 disables the delay.
+#ifndef LCD_HOST_BYTE_TIME_NS
+#define LCD_HOST_BYTE_TIME_NS		0
+#endif
+
+//! Maximum number of named sections bus traffic counters are broken down by
+#ifndef LCD_HOST_MAX_SECTIONS
+#define LCD_HOST_MAX_SECTIONS		24
+#endif
+
+//! Name of section entry counting sections that do not fit into LCD_HOST_MAX_SECTIONS entries
+#define LCD_HOST_OVERFLOW_SECTION	"(overflow)"
+
+//! Maximum nesting depth of sections
+#define LCD_HOST_SECTION_DEPTH		8
+
+//! Bus traffic counters of LcdHost module
+typedef struct
+{
+	unsigned long BytesWritten;		//!< All bytes sent over the bus, commands and data
+	unsigned long Windows;			//!< Column/row windows set, one-pixel points included
+	unsigned long Points;			//!< One-pixel point writes
+	unsigned long Pixels;			//!< Pixels written, one-pixel points included
+	unsigned long DmaTransfers;		//!< Runs written with WritePixelsAsync
+	unsigned long Reads;			//!< Pixels read back
+} LCD_HOST_COUNTERS_TYPE;
+
+//! Bus traffic of one named section, e.g. one Gui drawing function
+typedef struct
+{
+	const char *Name;				//!< Section name, compared by pointer
+	unsigned long Calls;			//!< Times the section was entered
+	LCD_HOST_COUNTERS_TYPE Counters;	//!< Traffic of the section itself, nested sections not included
+} LCD_HOST_SECTION_TYPE;
+
+extern const GRAPHIC_DRIVER_TYPE LcdHost_Driver;
+
+unsigned int LcdHost_GetPoint(unsigned short x, unsigned short y);
+void LcdHost_ResetCounters(void);
+LCD_HOST_COUNTERS_TYPE LcdHost_GetCounters(void);
+void LcdHost_Section(const char *name);
+const LCD_HOST_SECTION_TYPE* LcdHost_GetSections(unsigned char *count);
+bool LcdHost_DumpPpm(const char *path);
+
+#endif /* LCDHOST_H_ */
@@ -0,0 +1,179 @@
+/**
+ * @file LcdPort.c
+ *
+ * @brief Set of hardware dependent functions that transfer pixel data to LCD controller
+ *
+ * @details User needs to implement LCD initialization, one-pixel point write and, if LCD controller
+ * supports it, column/row window setup followed by a run of pixel data. If LCD_PORT_WINDOW_SUPPORT
+ * is set to 0 only LcdPort_Initialize, LcdPort_DrawPoint and LcdPort_GetPoint are used.
+ * Functions are handed to GraphicDriver module through LcdPort_Driver descriptor. Colors and pixel
+ * data come in LCD_PORT_PIXEL_FORMAT.
+ *
+ * With GRAPHIC_DRIVER_VSYNC enabled LCD controller tearing effect output has to be enabled, signaling
+ * vertical blanking, and TE line interrupt has to call GraphicDriver_VSync.
+ *
+ * @author Krzysztof Grzeszczak
+ *
+ * @version 1.0
+ *
+ * @date 2012-2013
+ *
+ * @copyright GNU Public License
+ */
+
+#include "LcdPort.h"
+#include <stddef.h>
+
+//! LcdPort module driver descriptor
+const GRAPHIC_DRIVER_TYPE LcdPort_Driver =
+{
+	LcdPort_Initialize,
+	LcdPort_DrawPoint,
+	LcdPort_GetPoint,
+	NULL,						//ReadSpan, pixel by pixel read back is used
+	NULL,						//GetRow
+	NULL,						//FillRect, window stream is used
+	NULL,						//WriteSpan, window stream is used
+	NULL,						//DrawMask, filled runs are used
+#if (LCD_PORT_WINDOW_SUPPORT != 0)
+	LcdPort_SetWindow,
+	LcdPort_WritePixels,
+	LcdPort_WriteColor,
+	LcdPort_EndWindow,
+#else
+	NULL,
+	NULL,
+	NULL,
+	NULL,
+#endif
+#if (LCD_PORT_WINDOW_SUPPORT != 0) && (LCD_PORT_ASYNC_SUPPORT != 0)
+	LcdPort_WritePixelsAsync,
+	LcdPort_Idle,
+#else
+	NULL,
+	NULL,
+#endif
+	NULL,						//Flush, nothing is buffered
+	NULL,						//FlushAsync
+	NULL,						//SetBand
+	NULL,						//GetDamagedRows
+	NULL,						//GetBandHeight
+	NULL,						//SetRotation, rotated by GraphicDriver module, could be memory access control
+	LCD_PORT_WIDTH,
+	LCD_PORT_HEIGHT,
+	LCD_PORT_PIXEL_FORMAT
+};
+
+/**
+ * @brief Initialize LCD module and enable it
+ * @todo Add specific LCD and MCU wise implementation
+ */
+void LcdPort_Initialize(void)
+{
+	do{}while(0);
+}
+
+/**
+ * @brief Draw one pixel with defined color on LCD
+ *
+ * @details Function draws point on the screen
+ * x = <0, LCD_PORT_WIDTH - 1> px, horizontal coordinate
+ * y = <0, LCD_PORT_HEIGHT - 1> px, vertical coordinate
+ * color = pixel value in LCD_PORT_PIXEL_FORMAT, e.g. 16-bit 5-6-5 format |RRRRR-GGGGGG-BBBBB| RGB color data
+ *
+ * @todo Add specific LCD and MCU wise implementation
+ */
+void LcdPort_DrawPoint(unsigned short x, unsigned short y, unsigned int color)
+{
+	(void)x;
+	(void)y;
+	(void)color;
+}
+
+/**
+ * @brief Get color data from pixel drawn on LCD
+ *
+ * @details Use LCD internal memory to read color data from given coordinates x and y
+ *
+ * @todo This implementation is optional.
+ */
+unsigned int LcdPort_GetPoint(unsigned short x, unsigned short y)
+{
+	(void)x;
+	(void)y;
+	return 0;
+}
+
+/**
+ * @brief Set LCD column/row window and start memory write
+ *
+ * @details Window covers x_start..x_end and y_start..y_end, both ends inclusive.
+ * Pixel data written afterwards fills the window row by row, left to right.
+ *
+ * @todo Add specific LCD and MCU wise implementation, e.g. column address set,
+ * page address set and memory write commands
+ */
+void LcdPort_SetWindow(unsigned short x_start, unsigned short y_start, unsigned short x_end, unsigned short y_end)
+{
+	(void)x_start;
+	(void)y_start;
+	(void)x_end;
+	(void)y_end;
+}
+
+/**
+ * @brief Write run of pixel data into window opened with LcdPort_SetWindow
+ *
+ * @todo Add specific LCD and MCU wise implementation
+ */
+void LcdPort_WritePixels(const void *pixels, unsigned int count)
+{
+	(void)pixels;
+	(void)count;
+}
+
+/**
+ * @brief Start DMA transfer of pixel data into window opened with LcdPort_SetWindow and return
+ *
+ * @details Used when LCD_PORT_ASYNC_SUPPORT is enabled. Pixel data stays untouched until transfer
+ * has finished. DMA completion interrupt has to call GraphicDriver_TransferComplete, which may
+ * start the next transfer from interrupt context.
+ *
+ * @todo Add specific LCD and MCU wise implementation
+ */
+void LcdPort_WritePixelsAsync(const void *pixels, unsigned int count)
+{
+	(void)pixels;
+	(void)count;
+}
+
+/**
+ * @brief Write the same color count times into window opened with LcdPort_SetWindow
+ *
+ * @todo Add specific LCD and MCU wise implementation
+ */
+void LcdPort_WriteColor(unsigned int color, unsigned int count)
+{
+	(void)color;
+	(void)count;
+}
+
+/**
+ * @brief Finish pixel data transfer into window, e.g. release chip select
+ *
+ * @todo Add specific LCD and MCU wise implementation
+ */
+void LcdPort_EndWindow(void)
+{
+	do{}while(0);
+}
+
+/**
+ * @brief Called repeatedly while waiting for LcdPort_WritePixelsAsync transfer to finish
+ *
+ * @todo Optional, e.g. wait for interrupt to save power
+ */
+void LcdPort_Idle(void)
+{
+	do{}while(0);
+}
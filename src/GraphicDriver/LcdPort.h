@@ -0,0 +1,59 @@
+/**
+ * @file LcdPort.h
+ *
+ * @brief LcdPort module API. Hardware dependent LCD bus functions used by GraphicDriver module.
+ *
+ * @author Krzysztof Grzeszczak
+ *
+ * @version 1.0
+ *
+ * @date 2012-2013
+ *
+ * @copyright GNU Public License
+ */
+
+#ifndef LCDPORT_H_
+#define LCDPORT_H_
+
+#include "GraphicDriver.h"
+
+//! Set to 0 when LCD controller can not stream pixels into column/row window. LcdPort_Driver then
+//! leaves window entries empty and GraphicDriver module emulates windows with one-pixel points.
+#ifndef LCD_PORT_WINDOW_SUPPORT
+#define LCD_PORT_WINDOW_SUPPORT		1
+#endif
+
+//! Set to 1 when LcdPort module implements LcdPort_WritePixelsAsync with DMA and calls
+//! GraphicDriver_TransferComplete from DMA completion interrupt. LcdPort_Driver then provides it.
+#ifndef LCD_PORT_ASYNC_SUPPORT
+#define LCD_PORT_ASYNC_SUPPORT		0
+#endif
+
+//! Horizontal resolution of the panel in pixel unit, in its native orientation
+#ifndef LCD_PORT_WIDTH
+#define LCD_PORT_WIDTH				320
+#endif
+
+//! Vertical resolution of the panel in pixel unit, in its native orientation
+#ifndef LCD_PORT_HEIGHT
+#define LCD_PORT_HEIGHT				240
+#endif
+
+//! Pixel format of LCD controller memory interface, PIXEL_FORMAT_TYPE
+#ifndef LCD_PORT_PIXEL_FORMAT
+#define LCD_PORT_PIXEL_FORMAT		PIXEL_FORMAT_RGB565
+#endif
+
+extern const GRAPHIC_DRIVER_TYPE LcdPort_Driver;
+
+void LcdPort_Initialize(void);
+void LcdPort_DrawPoint(unsigned short x, unsigned short y, unsigned int color);
+unsigned int LcdPort_GetPoint(unsigned short x, unsigned short y);
+void LcdPort_SetWindow(unsigned short x_start, unsigned short y_start, unsigned short x_end, unsigned short y_end);
+void LcdPort_WritePixels(const void *pixels, unsigned int count);
+void LcdPort_WritePixelsAsync(const void *pixels, unsigned int count);
+void LcdPort_WriteColor(unsigned int color, unsigned int count);
+void LcdPort_EndWindow(void);
+void LcdPort_Idle(void);
+
+#endif /* LCDPORT_H_ */
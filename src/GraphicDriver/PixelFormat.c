@@ -0,0 +1,417 @@
+/**
+ * @file PixelFormat.c
+ *
+ * @brief Pixel format kernels used by GraphicDriver and FrameBuffer modules
+ *
+ * @details Every supported format has its own set of fill, span and glyph blit kernels. Display driver
+ * descriptor names its format, GraphicDriver module picks the kernels once when driver is selected,
+ * so drawing never branches on format per pixel. Colors given to drawing functions are R5 G6 B5
+ * and converted to native pixel value once per call.
+ *
+ * PIXEL_FORMAT_INDEX8 uses R3 G3 B2 palette, converted arithmetically, until PixelFormat_SetPalette
+ * sets a custom one. Custom palette conversion searches for the nearest entry, so span conversion
+ * remembers the last color it has looked up.
+ *
+ * @author Krzysztof Grzeszczak
+ *
+ * @version 1.0
+ *
+ * @date 2012-2013
+ *
+ * @copyright GNU Public License
+ */
+
+#include "PixelFormat.h"
+#include <stddef.h>
+#include <string.h>
+
+static const unsigned short *Palette;	//!< Custom palette of PIXEL_FORMAT_INDEX8, NULL for R3 G3 B2
+
+static unsigned int PixelFormat_Rgb565FromRgb565(unsigned int color);
+static unsigned int PixelFormat_Rgb565Get(const void *row, unsigned int x);
+static void PixelFormat_Rgb565Fill(void *row, unsigned int x, unsigned int count, unsigned int pixel);
+static void PixelFormat_Rgb565Convert(void *row, unsigned int x, const unsigned short *colors, unsigned int count);
+static void PixelFormat_Rgb565Copy(void *row, unsigned int x, const void *pixels, unsigned int pixels_x, unsigned int count);
+static void PixelFormat_Rgb565Blit(void *row, unsigned int x, unsigned long mask, unsigned int count, unsigned int pixel);
+static unsigned int PixelFormat_Rgb888FromRgb565(unsigned int color);
+static unsigned int PixelFormat_Rgb888ToRgb565(unsigned int pixel);
+static unsigned int PixelFormat_Rgb888Get(const void *row, unsigned int x);
+static void PixelFormat_Rgb888Fill(void *row, unsigned int x, unsigned int count, unsigned int pixel);
+static void PixelFormat_Rgb888Convert(void *row, unsigned int x, const unsigned short *colors, unsigned int count);
+static void PixelFormat_Rgb888Copy(void *row, unsigned int x, const void *pixels, unsigned int pixels_x, unsigned int count);
+static void PixelFormat_Rgb888Blit(void *row, unsigned int x, unsigned long mask, unsigned int count, unsigned int pixel);
+static unsigned int PixelFormat_Index8FromRgb565(unsigned int color);
+static unsigned int PixelFormat_Index8ToRgb565(unsigned int pixel);
+static unsigned int PixelFormat_Index8Get(const void *row, unsigned int x);
+static void PixelFormat_Index8Fill(void *row, unsigned int x, unsigned int count, unsigned int pixel);
+static void PixelFormat_Index8Convert(void *row, unsigned int x, const unsigned short *colors, unsigned int count);
+static void PixelFormat_Index8Copy(void *row, unsigned int x, const void *pixels, unsigned int pixels_x, unsigned int count);
+static void PixelFormat_Index8Blit(void *row, unsigned int x, unsigned long mask, unsigned int count, unsigned int pixel);
+static unsigned int PixelFormat_Mono1FromRgb565(unsigned int color);
+static unsigned int PixelFormat_Mono1ToRgb565(unsigned int pixel);
+static unsigned int PixelFormat_Mono1Get(const void *row, unsigned int x);
+static void PixelFormat_Mono1Fill(void *row, unsigned int x, unsigned int count, unsigned int pixel);
+static void PixelFormat_Mono1Convert(void *row, unsigned int x, const unsigned short *colors, unsigned int count);
+static void PixelFormat_Mono1Copy(void *row, unsigned int x, const void *pixels, unsigned int pixels_x, unsigned int count);
+static void PixelFormat_Mono1Blit(void *row, unsigned int x, unsigned long mask, unsigned int count, unsigned int pixel);
+
+//! Kernels of every format, in PIXEL_FORMAT_TYPE order
+const PIXEL_FORMAT_KERNELS_TYPE PixelFormat_Kernels[] =
+{
+	{
+		16,
+		PixelFormat_Rgb565FromRgb565,
+		PixelFormat_Rgb565FromRgb565,
+		PixelFormat_Rgb565Get,
+		PixelFormat_Rgb565Fill,
+		PixelFormat_Rgb565Convert,
+		PixelFormat_Rgb565Copy,
+		PixelFormat_Rgb565Blit
+	},
+	{
+		24,
+		PixelFormat_Rgb888FromRgb565,
+		PixelFormat_Rgb888ToRgb565,
+		PixelFormat_Rgb888Get,
+		PixelFormat_Rgb888Fill,
+		PixelFormat_Rgb888Convert,
+		PixelFormat_Rgb888Copy,
+		PixelFormat_Rgb888Blit
+	},
+	{
+		8,
+		PixelFormat_Index8FromRgb565,
+		PixelFormat_Index8ToRgb565,
+		PixelFormat_Index8Get,
+		PixelFormat_Index8Fill,
+		PixelFormat_Index8Convert,
+		PixelFormat_Index8Copy,
+		PixelFormat_Index8Blit
+	},
+	{
+		1,
+		PixelFormat_Mono1FromRgb565,
+		PixelFormat_Mono1ToRgb565,
+		PixelFormat_Mono1Get,
+		PixelFormat_Mono1Fill,
+		PixelFormat_Mono1Convert,
+		PixelFormat_Mono1Copy,
+		PixelFormat_Mono1Blit
+	}
+};
+
+/**
+ * @brief Get kernels of defined pixel format
+ *
+ * @return Pointer to kernels, R5 G6 B5 kernels for unknown format
+ */
+const PIXEL_FORMAT_KERNELS_TYPE* PixelFormat_GetKernels(PIXEL_FORMAT_TYPE format)
+{
+	if( (unsigned int)format >= sizeof(PixelFormat_Kernels) / sizeof(PixelFormat_Kernels[0]) )
+	{
+		return &PixelFormat_Kernels[PIXEL_FORMAT_RGB565];
+	}
+	return &PixelFormat_Kernels[format];
+}
+
+/**
+ * @brief Set palette of PIXEL_FORMAT_INDEX8
+ *
+ * @param palette - 256 R5 G6 B5 entries, has to stay valid while used. NULL restores R3 G3 B2 palette.
+ */
+void PixelFormat_SetPalette(const unsigned short *palette)
+{
+	Palette = palette;
+}
+
+/**
+ * @brief Get number of bytes count pixels take, rounded up
+ */
+unsigned long PixelFormat_GetBytes(const PIXEL_FORMAT_KERNELS_TYPE *format, unsigned long count)
+{
+	return (count * format->BitsPerPixel + 7) / 8;
+}
+
+/**
+ * @brief R5 G6 B5 is native already
+ */
+unsigned int PixelFormat_Rgb565FromRgb565(unsigned int color)
+{
+	return color & 0xFFFF;
+}
+
+unsigned int PixelFormat_Rgb565Get(const void *row, unsigned int x)
+{
+	return ((const unsigned short *)row)[x];
+}
+
+void PixelFormat_Rgb565Fill(void *row, unsigned int x, unsigned int count, unsigned int pixel)
+{
+	unsigned short *pixels = (unsigned short *)row + x;
+
+	while(count-- > 0)
+	{
+		*pixels++ = (unsigned short)pixel;
+	}
+}
+
+void PixelFormat_Rgb565Convert(void *row, unsigned int x, const unsigned short *colors, unsigned int count)
+{
+	memcpy((unsigned short *)row + x, colors, count * sizeof(unsigned short));
+}
+
+void PixelFormat_Rgb565Copy(void *row, unsigned int x, const void *pixels, unsigned int pixels_x, unsigned int count)
+{
+	memcpy((unsigned short *)row + x, (const unsigned short *)pixels + pixels_x, count * sizeof(unsigned short));
+}
+
+void PixelFormat_Rgb565Blit(void *row, unsigned int x, unsigned long mask, unsigned int count, unsigned int pixel)
+{
+	unsigned short *pixels = (unsigned short *)row + x;
+
+	for( ; (mask != 0) && (count > 0); mask >>= 1, count--, pixels++)
+	{
+		if( (mask & 0x01) != 0 )
+		{
+			*pixels = (unsigned short)pixel;
+		}
+	}
+}
+
+/**
+ * @brief Expand R5 G6 B5 color to 0x00RRGGBB, so that white stays white
+ */
+unsigned int PixelFormat_Rgb888FromRgb565(unsigned int color)
+{
+	unsigned int red = (color >> 11) & 0x1F, green = (color >> 5) & 0x3F, blue = color & 0x1F;
+
+	red = (red << 3) | (red >> 2);
+	green = (green << 2) | (green >> 4);
+	blue = (blue << 3) | (blue >> 2);
+
+	return (red << 16) | (green << 8) | blue;
+}
+
+unsigned int PixelFormat_Rgb888ToRgb565(unsigned int pixel)
+{
+	return ( (pixel >> 8) & 0xF800 ) | ( (pixel >> 5) & 0x07E0 ) | ( (pixel >> 3) & 0x001F );
+}
+
+unsigned int PixelFormat_Rgb888Get(const void *row, unsigned int x)
+{
+	const unsigned char *bytes = (const unsigned char *)row + 3 * x;
+
+	return ( (unsigned int)bytes[0] << 16 ) | ( (unsigned int)bytes[1] << 8 ) | bytes[2];
+}
+
+void PixelFormat_Rgb888Fill(void *row, unsigned int x, unsigned int count, unsigned int pixel)
+{
+	unsigned char *bytes = (unsigned char *)row + 3 * x;
+	unsigned char red = (unsigned char)(pixel >> 16), green = (unsigned char)(pixel >> 8), blue = (unsigned char)pixel;
+
+	while(count-- > 0)
+	{
+		*bytes++ = red;
+		*bytes++ = green;
+		*bytes++ = blue;
+	}
+}
+
+void PixelFormat_Rgb888Convert(void *row, unsigned int x, const unsigned short *colors, unsigned int count)
+{
+	unsigned int i;
+
+	for(i = 0; i < count; i++)
+	{
+		PixelFormat_Rgb888Fill(row, x + i, 1, PixelFormat_Rgb888FromRgb565(colors[i]));
+	}
+}
+
+void PixelFormat_Rgb888Copy(void *row, unsigned int x, const void *pixels, unsigned int pixels_x, unsigned int count)
+{
+	memcpy((unsigned char *)row + 3 * x, (const unsigned char *)pixels + 3 * pixels_x, 3 * count);
+}
+
+void PixelFormat_Rgb888Blit(void *row, unsigned int x, unsigned long mask, unsigned int count, unsigned int pixel)
+{
+	for( ; (mask != 0) && (count > 0); mask >>= 1, count--, x++)
+	{
+		if( (mask & 0x01) != 0 )
+		{
+			PixelFormat_Rgb888Fill(row, x, 1, pixel);
+		}
+	}
+}
+
+/**
+ * @brief Get palette index of R5 G6 B5 color, nearest entry of custom palette
+ */
+unsigned int PixelFormat_Index8FromRgb565(unsigned int color)
+{
+	long red = (color >> 11) & 0x1F, green = (color >> 5) & 0x3F, blue = color & 0x1F;
+	long distance, best_distance = 0x7FFFFFFF;
+	unsigned int i, best_index = 0;
+
+	if(Palette == NULL)
+	{
+		return ( (red >> 2) << 5 ) | ( (green >> 3) << 2 ) | (blue >> 3);
+	}
+
+	for(i = 0; (i < 256) && (best_distance > 0); i++)
+	{
+		//Green has twice the resolution, so channel differences are compared on the same scale
+		distance = 4 * (red - ( (Palette[i] >> 11) & 0x1F )) * (red - ( (Palette[i] >> 11) & 0x1F ))
+				+ (green - ( (Palette[i] >> 5) & 0x3F )) * (green - ( (Palette[i] >> 5) & 0x3F ))
+				+ 4 * (blue - (Palette[i] & 0x1F)) * (blue - (Palette[i] & 0x1F));
+		if(distance < best_distance)
+		{
+			best_distance = distance;
+			best_index = i;
+		}
+	}
+	return best_index;
+}
+
+unsigned int PixelFormat_Index8ToRgb565(unsigned int pixel)
+{
+	unsigned int red = (pixel >> 5) & 0x07, green = (pixel >> 2) & 0x07, blue = pixel & 0x03;
+
+	if(Palette != NULL)
+	{
+		return Palette[pixel & 0xFF];
+	}
+
+	red = (red << 2) | (red >> 1);
+	green = (green << 3) | (green);
+	blue = (blue << 3) | (blue << 1) | (blue >> 1);
+
+	return (red << 11) | (green << 5) | blue;
+}
+
+unsigned int PixelFormat_Index8Get(const void *row, unsigned int x)
+{
+	return ((const unsigned char *)row)[x];
+}
+
+void PixelFormat_Index8Fill(void *row, unsigned int x, unsigned int count, unsigned int pixel)
+{
+	memset((unsigned char *)row + x, (int)pixel, count);
+}
+
+void PixelFormat_Index8Convert(void *row, unsigned int x, const unsigned short *colors, unsigned int count)
+{
+	unsigned char *pixels = (unsigned char *)row + x;
+	unsigned int last_color = ~colors[0] & 0xFFFF, last_index = 0;
+
+	while(count-- > 0)
+	{
+		//Spans hold few colors, search for nearest palette entry only when color changes
+		if(*colors != last_color)
+		{
+			last_color = *colors;
+			last_index = PixelFormat_Index8FromRgb565(last_color);
+		}
+		*pixels++ = (unsigned char)last_index;
+		colors++;
+	}
+}
+
+void PixelFormat_Index8Copy(void *row, unsigned int x, const void *pixels, unsigned int pixels_x, unsigned int count)
+{
+	memcpy((unsigned char *)row + x, (const unsigned char *)pixels + pixels_x, count);
+}
+
+void PixelFormat_Index8Blit(void *row, unsigned int x, unsigned long mask, unsigned int count, unsigned int pixel)
+{
+	unsigned char *pixels = (unsigned char *)row + x;
+
+	for( ; (mask != 0) && (count > 0); mask >>= 1, count--, pixels++)
+	{
+		if( (mask & 0x01) != 0 )
+		{
+			*pixels = (unsigned char)pixel;
+		}
+	}
+}
+
+/**
+ * @brief Pixel is lit when luminance of R5 G6 B5 color is at least half
+ */
+unsigned int PixelFormat_Mono1FromRgb565(unsigned int color)
+{
+	unsigned int red = (color >> 11) & 0x1F, green = (color >> 5) & 0x3F, blue = color & 0x1F;
+
+	//Y = 0.299 R + 0.587 G + 0.114 B on 0..255 scale
+	return ( (77 * (red << 3) + 150 * (green << 2) + 29 * (blue << 3)) >= (128 << 8) ) ? 1 : 0;
+}
+
+unsigned int PixelFormat_Mono1ToRgb565(unsigned int pixel)
+{
+	return (pixel != 0) ? 0xFFFF : 0x0000;
+}
+
+unsigned int PixelFormat_Mono1Get(const void *row, unsigned int x)
+{
+	return ( ((const unsigned char *)row)[x >> 3] >> (7 - (x & 0x07)) ) & 0x01;
+}
+
+void PixelFormat_Mono1Fill(void *row, unsigned int x, unsigned int count, unsigned int pixel)
+{
+	unsigned char *bytes = (unsigned char *)row + (x >> 3);
+	unsigned char bits;
+	unsigned int run;
+
+	while(count > 0)
+	{
+		//Bits of one byte at once, whole bytes in the middle of the run
+		run = 8 - (x & 0x07);
+		if(run > count)
+		{
+			run = count;
+		}
+		bits = (unsigned char)( (0xFF >> (x & 0x07)) & (0xFF << (8 - (x & 0x07) - run)) );
+
+		*bytes = (pixel != 0) ? (*bytes | bits) : (*bytes & ~bits);
+
+		bytes++;
+		x += run;
+		count -= run;
+	}
+}
+
+void PixelFormat_Mono1Convert(void *row, unsigned int x, const unsigned short *colors, unsigned int count)
+{
+	unsigned int i;
+
+	for(i = 0; i < count; i++)
+	{
+		PixelFormat_Mono1Fill(row, x + i, 1, PixelFormat_Mono1FromRgb565(colors[i]));
+	}
+}
+
+void PixelFormat_Mono1Copy(void *row, unsigned int x, const void *pixels, unsigned int pixels_x, unsigned int count)
+{
+	unsigned int i;
+
+	if( ( (x & 0x07) == 0 ) && ( (pixels_x & 0x07) == 0 ) && ( (count & 0x07) == 0 ) )
+	{
+		memcpy((unsigned char *)row + (x >> 3), (const unsigned char *)pixels + (pixels_x >> 3), count >> 3);
+		return;
+	}
+
+	for(i = 0; i < count; i++)
+	{
+		PixelFormat_Mono1Fill(row, x + i, 1, PixelFormat_Mono1Get(pixels, pixels_x + i));
+	}
+}
+
+void PixelFormat_Mono1Blit(void *row, unsigned int x, unsigned long mask, unsigned int count, unsigned int pixel)
+{
+	for( ; (mask != 0) && (count > 0); mask >>= 1, count--, x++)
+	{
+		if( (mask & 0x01) != 0 )
+		{
+			PixelFormat_Mono1Fill(row, x, 1, pixel);
+		}
+	}
+}
@@ -0,0 +1,50 @@
+/**
+ * @file PixelFormat.h
+ *
+ * @brief PixelFormat module API.
+ *
+ * @author Krzysztof Grzeszczak
+ *
+ * @version 1.0
+ *
+ * @date 2012-2013
+ *
+ * @copyright GNU Public License
+ */
+
+#ifndef PIXELFORMAT_H_
+#define PIXELFORMAT_H_
+
+#include "../Typedefs.h"
+
+//! Pixel format of display memory and of pixel data passed to display driver
+typedef enum
+{
+	PIXEL_FORMAT_RGB565 = 0,	//!< 16-bit R5 G6 B5, one unsigned short per pixel
+	PIXEL_FORMAT_RGB888,		//!< 24-bit R8 G8 B8, three bytes per pixel in R, G, B order
+	PIXEL_FORMAT_INDEX8,		//!< 8-bit palette index, R3 G3 B2 palette unless PixelFormat_SetPalette is used
+	PIXEL_FORMAT_MONO1			//!< 1-bit monochrome, eight pixels per byte, leftmost pixel in MSB
+} PIXEL_FORMAT_TYPE;
+
+//! Format-specialized kernels. Rows are packed pixel data, x counts pixels from the start of the row.
+//! Native pixel values are R5 G6 B5 word, 0x00RRGGBB, palette index or 0/1.
+typedef struct
+{
+	unsigned char BitsPerPixel;
+	unsigned int (* FromRgb565)(unsigned int color);	//!< Convert R5 G6 B5 color to native pixel value
+	unsigned int (* ToRgb565)(unsigned int pixel);		//!< Convert native pixel value back to R5 G6 B5 color
+	unsigned int (* Get)(const void *row, unsigned int x);	//!< Read native pixel value
+	void (* Fill)(void *row, unsigned int x, unsigned int count, unsigned int pixel);	//!< Store native pixel value count times
+	void (* Convert)(void *row, unsigned int x, const unsigned short *colors, unsigned int count);	//!< Store R5 G6 B5 colors
+	void (* Copy)(void *row, unsigned int x, const void *pixels, unsigned int pixels_x, unsigned int count);	//!< Store packed pixels starting at pixels_x
+	void (* Blit)(void *row, unsigned int x, unsigned long mask, unsigned int count, unsigned int pixel);	//!< Store native pixel value where mask bit is set, bit 0 first
+} PIXEL_FORMAT_KERNELS_TYPE;
+
+//! Kernels of every format, in PIXEL_FORMAT_TYPE order, e.g. for static initialization
+extern const PIXEL_FORMAT_KERNELS_TYPE PixelFormat_Kernels[];
+
+const PIXEL_FORMAT_KERNELS_TYPE* PixelFormat_GetKernels(PIXEL_FORMAT_TYPE format);
+void PixelFormat_SetPalette(const unsigned short *palette);
+unsigned long PixelFormat_GetBytes(const PIXEL_FORMAT_KERNELS_TYPE *format, unsigned long count);
+
+#endif /* PIXELFORMAT_H_ */
@@ -0,0 +1,309 @@
+/**
+ * @file ShadowBuffer.c
+ *
+ * @brief RAM copy of display content used by GraphicDriver module when GRAPHIC_DRIVER_SHADOW is enabled
+ *
+ * @details Sits in front of display driver and mirrors every pixel sent to it, so pixels are read
+ * back from RAM instead of over the LCD bus, which is slow or not available at all. Drawing is
+ * forwarded to display driver unchanged, one store into the shadow per call on the way.
+ *
+ * Shadow holds pixels in display pixel format, sized for GRAPHIC_DRIVER_MAX_WIDTH *
+ * GRAPHIC_DRIVER_MAX_HEIGHT pixels at GRAPHIC_DRIVER_SHADOW_BPP. Rows that do not fit are read
+ * back from display driver.
+ *
+ * @author Krzysztof Grzeszczak
+ *
+ * @version 1.0
+ *
+ * @date 2012-2013
+ *
+ * @copyright GNU Public License
+ */
+
+#include "ShadowBuffer.h"
+#include <stddef.h>
+#include <string.h>
+
+#if (GRAPHIC_DRIVER_SHADOW != 0)
+
+//! ShadowBuffer module driver descriptor, resolution and pixel format are taken from target
+const GRAPHIC_DRIVER_TYPE ShadowBuffer_Driver =
+{
+	ShadowBuffer_Initialize,
+	ShadowBuffer_DrawPoint,
+	ShadowBuffer_GetPoint,
+	ShadowBuffer_ReadSpan,
+	ShadowBuffer_GetRow,
+	ShadowBuffer_FillRect,
+	ShadowBuffer_WriteSpan,
+	ShadowBuffer_DrawMask,
+	ShadowBuffer_SetWindow,
+	ShadowBuffer_WritePixels,
+	ShadowBuffer_WriteColor,
+	ShadowBuffer_EndWindow,
+	ShadowBuffer_WritePixelsAsync,
+	NULL,						//Idle, same as target
+	NULL,						//Flush, nothing is buffered
+	NULL,						//FlushAsync
+	NULL,						//SetBand
+	NULL,						//GetDamagedRows
+	NULL,						//GetBandHeight
+	NULL,						//SetRotation, target is already rotated
+	0,							//Width, same as target
+	0,							//Height
+	PIXEL_FORMAT_RGB565			//PixelFormat, same as target
+};
+
+static unsigned short Pixels[(GRAPHIC_DRIVER_MAX_WIDTH * GRAPHIC_DRIVER_MAX_HEIGHT * GRAPHIC_DRIVER_SHADOW_BPP + 15) / 16];	//!< Display content
+static const GRAPHIC_DRIVER_TYPE *Target;			//!< Driver shadow is kept for
+static const PIXEL_FORMAT_KERNELS_TYPE *Format;		//!< Kernels of target pixel format
+static unsigned int Width;							//!< Target screen width
+static unsigned int Rows;							//!< Screen rows held in the shadow
+static unsigned int Stride;							//!< Bytes of one shadow row
+static unsigned int WindowXStart;					//!< Leftmost column of current window
+static unsigned int WindowXEnd;						//!< Rightmost column of current window
+static unsigned int WindowYEnd;						//!< Bottom row of current window
+static unsigned int WindowX;						//!< Column of next pixel in current window
+static unsigned int WindowY;						//!< Row of next pixel in current window
+
+static void ShadowBuffer_Clear(void);
+static void ShadowBuffer_StoreRun(const void *pixels, unsigned int color, unsigned int count);
+
+/**
+ * @brief Set driver shadow is kept for and take its resolution and pixel format, shadow is cleared
+ */
+void ShadowBuffer_SetTarget(const GRAPHIC_DRIVER_TYPE *target)
+{
+	Target = target;
+	Format = PixelFormat_GetKernels(target->PixelFormat);
+	Width = target->Width;
+	Stride = PixelFormat_GetBytes(Format, Width);
+	Rows = sizeof(Pixels) / Stride;
+	if(Rows > target->Height)
+	{
+		Rows = target->Height;
+	}
+
+	ShadowBuffer_Clear();
+}
+
+/**
+ * @brief Initialize target driver and clear the shadow
+ */
+void ShadowBuffer_Initialize(void)
+{
+	if(Target->Initialize != NULL)
+	{
+		Target->Initialize();
+	}
+	ShadowBuffer_Clear();
+}
+
+/**
+ * @brief Store one pixel and draw it
+ */
+void ShadowBuffer_DrawPoint(unsigned short x, unsigned short y, unsigned int color)
+{
+	if( (x < Width) && (y < Rows) )
+	{
+		Format->Fill((unsigned char *)Pixels + y * Stride, x, 1, color);
+	}
+	Target->DrawPoint(x, y, color);
+}
+
+/**
+ * @brief Get native pixel value from the shadow
+ */
+unsigned int ShadowBuffer_GetPoint(unsigned short x, unsigned short y)
+{
+	if( (x < Width) && (y < Rows) )
+	{
+		return Format->Get((unsigned char *)Pixels + y * Stride, x);
+	}
+	return Target->GetPoint(x, y);
+}
+
+/**
+ * @brief Read span of native pixel data from the shadow, packed from the start of pixels
+ */
+void ShadowBuffer_ReadSpan(unsigned short x, unsigned short y, unsigned short length, void *pixels)
+{
+	if( (y >= Rows) || ((unsigned int)x + length > Width) )
+	{
+		Target->ReadSpan(x, y, length, pixels);
+		return;
+	}
+	Format->Copy(pixels, 0, (unsigned char *)Pixels + y * Stride, x, length);
+}
+
+/**
+ * @brief Get pixel data of screen row from the shadow, e.g. to find pixels that changed since they were sent
+ *
+ * @return pointer to packed row data, NULL when row is not shadowed
+ */
+const void* ShadowBuffer_GetRow(unsigned short y)
+{
+	if(y >= Rows)
+	{
+		return NULL;
+	}
+	return (const unsigned char *)Pixels + y * Stride;
+}
+
+/**
+ * @brief Store rectangle and fill it
+ */
+void ShadowBuffer_FillRect(unsigned short x, unsigned short y, unsigned short width, unsigned short height, unsigned int color)
+{
+	unsigned int row, x_end = (unsigned int)x + width, y_end = (unsigned int)y + height;
+
+	if(x_end > Width)
+	{
+		x_end = Width;
+	}
+	if(y_end > Rows)
+	{
+		y_end = Rows;
+	}
+
+	for(row = y; (row < y_end) && (x < x_end); row++)
+	{
+		Format->Fill((unsigned char *)Pixels + row * Stride, x, x_end - x, color);
+	}
+	Target->FillRect(x, y, width, height, color);
+}
+
+/**
+ * @brief Store span and write it
+ */
+void ShadowBuffer_WriteSpan(unsigned short x, unsigned short y, unsigned short length, const void *pixels)
+{
+	if( (x < Width) && (y < Rows) )
+	{
+		Format->Copy((unsigned char *)Pixels + y * Stride, x, pixels, 0, (x + length <= Width) ? length : Width - x);
+	}
+	Target->WriteSpan(x, y, length, pixels);
+}
+
+/**
+ * @brief Store masked row and draw it
+ */
+void ShadowBuffer_DrawMask(unsigned short x, unsigned short y, unsigned short width, unsigned long mask, unsigned int color)
+{
+	if( (x < Width) && (y < Rows) )
+	{
+		Format->Blit((unsigned char *)Pixels + y * Stride, x, mask, (x + width <= Width) ? width : Width - x, color);
+	}
+	Target->DrawMask(x, y, width, mask, color);
+}
+
+/**
+ * @brief Open window, pixels streamed into it are stored row by row
+ */
+void ShadowBuffer_SetWindow(unsigned short x_start, unsigned short y_start, unsigned short x_end, unsigned short y_end)
+{
+	WindowXStart = x_start;
+	WindowXEnd = x_end;
+	WindowYEnd = y_end;
+	WindowX = x_start;
+	WindowY = y_start;
+
+	if(Target->SetWindow != NULL)
+	{
+		Target->SetWindow(x_start, y_start, x_end, y_end);
+	}
+}
+
+/**
+ * @brief Store run of pixels and stream it into window
+ */
+void ShadowBuffer_WritePixels(const void *pixels, unsigned int count)
+{
+	ShadowBuffer_StoreRun(pixels, 0, count);
+	Target->WritePixels(pixels, count);
+}
+
+/**
+ * @brief Store the same color count times and stream it into window
+ */
+void ShadowBuffer_WriteColor(unsigned int color, unsigned int count)
+{
+	ShadowBuffer_StoreRun(NULL, color, count);
+	Target->WriteColor(color, count);
+}
+
+/**
+ * @brief Close window
+ */
+void ShadowBuffer_EndWindow(void)
+{
+	if(Target->EndWindow != NULL)
+	{
+		Target->EndWindow();
+	}
+}
+
+/**
+ * @brief Store run of pixels and start its DMA stream into window
+ */
+void ShadowBuffer_WritePixelsAsync(const void *pixels, unsigned int count)
+{
+	ShadowBuffer_StoreRun(pixels, 0, count);
+	Target->WritePixelsAsync(pixels, count);
+}
+
+/**
+ * @brief Clear shadow, display content is unknown until drawn
+ */
+void ShadowBuffer_Clear(void)
+{
+	memset(Pixels, 0, sizeof(Pixels));
+}
+
+/**
+ * @brief Store pixel data at window cursor row by row and advance the cursor
+ *
+ * @param pixels - packed pixel data, or NULL to store color count times
+ * @param color - color used when pixels is NULL
+ * @param count - number of pixels
+ */
+void ShadowBuffer_StoreRun(const void *pixels, unsigned int color, unsigned int count)
+{
+	unsigned int run, column_end, pixels_x = 0;
+	unsigned char *row;
+
+	while( (count > 0) && (WindowY <= WindowYEnd) )
+	{
+		//Part of the run that fits into current window row
+		run = WindowXEnd - WindowX + 1;
+		if(run > count)
+		{
+			run = count;
+		}
+
+		column_end = (WindowX + run < Width) ? WindowX + run : Width;
+		if( (WindowY < Rows) && (WindowX < column_end) )
+		{
+			row = (unsigned char *)Pixels + WindowY * Stride;
+			if(pixels != NULL)
+			{
+				Format->Copy(row, WindowX, pixels, pixels_x, column_end - WindowX);
+			}
+			else
+			{
+				Format->Fill(row, WindowX, column_end - WindowX, color);
+			}
+		}
+
+		pixels_x += run;
+		count -= run;
+		WindowX += run;
+		if(WindowX > WindowXEnd)
+		{
+			WindowX = WindowXStart;
+			WindowY++;
+		}
+	}
+}
+
+#endif /* GRAPHIC_DRIVER_SHADOW */
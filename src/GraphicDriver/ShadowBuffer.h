@@ -0,0 +1,38 @@
+/**
+ * @file ShadowBuffer.h
+ *
+ * @brief ShadowBuffer module API.
+ *
+ * @author Krzysztof Grzeszczak
+ *
+ * @version 1.0
+ *
+ * @date 2012-2013
+ *
+ * @copyright GNU Public License
+ */
+
+#ifndef SHADOWBUFFER_H_
+#define SHADOWBUFFER_H_
+
+#include "GraphicDriver.h"
+#include "../Typedefs.h"
+
+extern const GRAPHIC_DRIVER_TYPE ShadowBuffer_Driver;
+
+void ShadowBuffer_SetTarget(const GRAPHIC_DRIVER_TYPE *target);
+void ShadowBuffer_Initialize(void);
+void ShadowBuffer_DrawPoint(unsigned short x, unsigned short y, unsigned int color);
+unsigned int ShadowBuffer_GetPoint(unsigned short x, unsigned short y);
+void ShadowBuffer_ReadSpan(unsigned short x, unsigned short y, unsigned short length, void *pixels);
+const void* ShadowBuffer_GetRow(unsigned short y);
+void ShadowBuffer_FillRect(unsigned short x, unsigned short y, unsigned short width, unsigned short height, unsigned int color);
+void ShadowBuffer_WriteSpan(unsigned short x, unsigned short y, unsigned short length, const void *pixels);
+void ShadowBuffer_DrawMask(unsigned short x, unsigned short y, unsigned short width, unsigned long mask, unsigned int color);
+void ShadowBuffer_SetWindow(unsigned short x_start, unsigned short y_start, unsigned short x_end, unsigned short y_end);
+void ShadowBuffer_WritePixels(const void *pixels, unsigned int count);
+void ShadowBuffer_WriteColor(unsigned int color, unsigned int count);
+void ShadowBuffer_EndWindow(void);
+void ShadowBuffer_WritePixelsAsync(const void *pixels, unsigned int count);
+
+#endif /* SHADOWBUFFER_H_ */
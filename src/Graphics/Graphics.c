@@ -6,6 +6,15 @@
  * @details User needs to implement LCD driver initialization and function that draws one-pixel point at
  * define x and y coordinate
  *
+ * All primitives are clipped to the screen and to the clip rectangle on top of the stack kept by Graphics_PushClip
+ * and Graphics_PopClip, nested rectangles are intersected. Primitive wholly outside is rejected before it is
+ * rasterized, rectangles, spans and glyph rows are trimmed, lines are trimmed to the rasterizer steps within
+ * clip, so nothing outside of the screen reaches the driver.
+ *
+ * With GRAPHICS_GLYPH_CACHE_SIZE set, opaque text keeps glyphs expanded to display pixel format for each font,
+ * character and color pair in a bounded cache. Wholly visible characters found there are streamed into their
+ * window as they are, least recently used glyphs make room for new ones.
+ *
  * @author Krzysztof Grzeszczak
  *
  * @version 1.0
@@ -16,6 +25,125 @@
  */
 
 #include "Graphics.h"
+#include <stddef.h>
+#include <string.h>
+
+//! Greatest coordinate taken as it is, greater ones are offsets left of or above the screen wrapped around
+#define GRAPHICS_COORDINATE_MAX	0x7FFF
+
+//! Coordinate as signed value, wrapped around ones are negative
+#define GRAPHICS_SIGNED(c)		( ((c) > GRAPHICS_COORDINATE_MAX) ? (int)(c) - 0x10000 : (int)(c) )
+
+#if (GRAPHICS_GLYPH_CACHE_SIZE != 0)
+//! Glyph expanded to display pixel format, kept in glyph cache
+typedef struct
+{
+	const PIXEL_FORMAT_KERNELS_TYPE *Format;	//Pixel format of pixel data
+	FONT_SIZE_TYPE FontSize;
+	unsigned char Char;
+	unsigned int Color;
+	unsigned int Background;
+	unsigned int Offset;						//Offset of pixel data in GlyphCachePool, in bytes
+	unsigned int Size;							//Size of pixel data in bytes
+	unsigned long LastUse;						//Value of GlyphCacheClock at last lookup
+} GRAPHICS_GLYPH_CACHE_ENTRY_TYPE;
+#endif
+
+//! Clip rectangles, end coordinates exclusive. Entry 0 is the screen, entry ClipDepth is the current clip.
+static unsigned short ClipXStart[GRAPHICS_CLIP_DEPTH + 1] = {0};		//!< Leftmost clipped in column
+static unsigned short ClipYStart[GRAPHICS_CLIP_DEPTH + 1] = {0};		//!< Top clipped in row
+static unsigned short ClipXEnd[GRAPHICS_CLIP_DEPTH + 1] = {0};		//!< Column right of clip rectangle, entry 0 set by Graphics_ClipToScreen
+static unsigned short ClipYEnd[GRAPHICS_CLIP_DEPTH + 1] = {0};		//!< Row below clip rectangle, entry 0 set by Graphics_ClipToScreen
+static unsigned char ClipDepth = 0;											//!< Number of pushed clip rectangles
+#if (GRAPHICS_GLYPH_CACHE_SIZE != 0)
+static unsigned long GlyphCachePool[(GRAPHICS_GLYPH_CACHE_SIZE + sizeof(unsigned long) - 1) / sizeof(unsigned long)];	//!< Pixel data of cached glyphs, packed from the start
+static GRAPHICS_GLYPH_CACHE_ENTRY_TYPE GlyphCache[GRAPHICS_GLYPH_CACHE_ENTRIES];		//!< Cached glyphs in pool order
+static unsigned short GlyphCacheCount = 0;											//!< Number of cached glyphs
+static unsigned int GlyphCacheBytes = 0;											//!< Pool bytes in use
+static unsigned long GlyphCacheClock = 0;											//!< Glyph cache lookups, time stamp of LRU order
+static unsigned long GlyphCacheHits = 0;											//!< Lookups that found glyph since statistics reset
+static unsigned long GlyphCacheMisses = 0;											//!< Lookups that expanded glyph since statistics reset
+static unsigned long GlyphCacheEvictions = 0;										//!< Glyphs evicted since statistics reset
+#endif
+
+static void Graphics_ClipToScreen(void);
+static void Graphics_FillClipped(int x_start, int y_start, int x_end, int y_end, unsigned int color);
+static int Graphics_GetLineStep(int major, int minor, int offset);
+static void Graphics_DrawMaskClipped(int x, int y, unsigned short width, unsigned long mask, unsigned int color);
+static void Graphics_DrawGlyph(int x_left, int y_top, const FONT_TYPE *Font, unsigned char ascii_char, unsigned int color);
+static void Graphics_DrawRunOpaque(int x_left,
+									int y_top,
+									const char *string,
+									unsigned short count,
+									const FONT_TYPE *Font,
+									unsigned int color,
+									unsigned int background);
+#if (GRAPHICS_GLYPH_CACHE_SIZE != 0)
+static bool Graphics_DrawCachedGlyph(int x_left,
+									int y_top,
+									const FONT_TYPE *Font,
+									FONT_SIZE_TYPE font_size,
+									unsigned char ascii_char,
+									unsigned int color,
+									unsigned int background);
+static const unsigned char* Graphics_GetCachedGlyph(const FONT_TYPE *Font,
+													FONT_SIZE_TYPE font_size,
+													unsigned char ascii_char,
+													unsigned int color,
+													unsigned int background,
+													const PIXEL_FORMAT_KERNELS_TYPE *Format);
+#endif
+
+/**
+ * @brief Push clip rectangle, following drawing is limited to its intersection with clip rectangles already pushed
+ *
+ * @param x - leftmost column of clip rectangle
+ * @param y - top row of clip rectangle
+ * @param width - clip rectangle width, may be 0 to clip everything away
+ * @param height - clip rectangle height
+ *
+ * @return FALSE if GRAPHICS_CLIP_DEPTH rectangles are already pushed, clip is left unchanged
+ */
+bool Graphics_PushClip(unsigned short x, unsigned short y, unsigned short width, unsigned short height)
+{
+	unsigned int x_end = (unsigned int)x + width;
+	unsigned int y_end = (unsigned int)y + height;
+
+	if(ClipDepth >= GRAPHICS_CLIP_DEPTH)
+	{
+		return FALSE;
+	}
+
+	Graphics_ClipToScreen();
+	ClipXStart[ClipDepth + 1] = MAX(x, ClipXStart[ClipDepth]);
+	ClipYStart[ClipDepth + 1] = MAX(y, ClipYStart[ClipDepth]);
+	ClipXEnd[ClipDepth + 1] = MIN(x_end, ClipXEnd[ClipDepth]);
+	ClipYEnd[ClipDepth + 1] = MIN(y_end, ClipYEnd[ClipDepth]);
+	ClipDepth++;
+
+	//Disjoint rectangles leave empty clip, start is kept not above end
+	if(ClipXEnd[ClipDepth] < ClipXStart[ClipDepth])
+	{
+		ClipXEnd[ClipDepth] = ClipXStart[ClipDepth];
+	}
+	if(ClipYEnd[ClipDepth] < ClipYStart[ClipDepth])
+	{
+		ClipYEnd[ClipDepth] = ClipYStart[ClipDepth];
+	}
+
+	return TRUE;
+}
+
+/**
+ * @brief Pop clip rectangle pushed last, does nothing if none is pushed
+ */
+void Graphics_PopClip(void)
+{
+	if(ClipDepth > 0)
+	{
+		ClipDepth--;
+	}
+}
 
 /**
  * @brief Draw Rectangle filled with defined color
@@ -33,19 +161,20 @@ void Graphics_DrawRect(unsigned short x_start,
 						unsigned short y_end,
 						unsigned int color)
 {
-	unsigned short x,y;
-
-	for(y = y_start; y <  y_end; y++)
-	{
-		for(x = x_start; x < x_end; x++)
-		{
-			GraphicDriver_DrawPoint(x,y,color);
-		}
-	}
+	Graphics_ClipToScreen();
+	Graphics_FillClipped(x_start, y_start, x_end, y_end, color);
 }
 
 /**
- * @brief Draw line with defined color
+ * @brief Draw line with defined color, from x_start, y_start up to x_end, y_end, end point excluded
+ *
+ * @details Incremental Bresenham rasterizer, no division per pixel, exact in all octants: every pixel is the one
+ * nearest to the ideal line along the minor axis. Line is always rasterized from the end with lower major
+ * coordinate, so the same line given either way covers the same pixels apart from the excluded end point.
+ * Horizontal and vertical lines are sent to the driver as a single rectangle fill.
+ *
+ * Coordinates greater than 0x7FFF are taken as negative ones wrapped around, like in Graphics_DrawString.
+ * Line is clipped before it is rasterized, only steps within the clip rectangle are walked.
  */
 void Graphics_DrawLine(unsigned short x_start,
 						unsigned short y_start,
@@ -53,65 +182,170 @@ void Graphics_DrawLine(unsigned short x_start,
 						unsigned short y_end,
 						unsigned int color)
 {
-	signed short x_width = 0, y_width = 0, x_abs, y_abs;
-	signed short delta = 0;
-	unsigned short i;
+	int x_first, y_first, x_last, y_last, x_width, y_width, major, minor, error, step, step_end, x, y;
+	int major_first, minor_first, major_clip_start, major_clip_end, minor_clip_start, minor_clip_end, minor_sign;
+	int x_major_step = 0, y_major_step = 0, x_minor_step = 0, y_minor_step = 0;
+	long long minor_steps;
+	bool is_x_major;
 
-	x_width = x_end - x_start;
-	y_width = y_end - y_start;
+	x_first = GRAPHICS_SIGNED(x_start);
+	y_first = GRAPHICS_SIGNED(y_start);
+	x_last = GRAPHICS_SIGNED(x_end);
+	y_last = GRAPHICS_SIGNED(y_end);
+	x_width = x_last - x_first;
+	y_width = y_last - y_first;
+	Graphics_ClipToScreen();
 
-	x_abs = ABS(x_width);
-	y_abs = ABS(y_width);
+	//Axis aligned line is one span fill, it covers the same pixels as the rasterizer below
+	if( (y_width == 0) && (x_width != 0) )
+	{
+		x = (x_width > 0) ? x_first : x_last + 1;
+		Graphics_FillClipped(x, y_first, x + ABS(x_width), y_first + 1, color);
+		return;
+	}
+	if( (x_width == 0) && (y_width != 0) )
+	{
+		y = (y_width > 0) ? y_first : y_last + 1;
+		Graphics_FillClipped(x_first, y, x_first + 1, y + ABS(y_width), color);
+		return;
+	}
 
-	if( x_abs > y_abs )
+	is_x_major = ( ABS(x_width) > ABS(y_width) ) ? TRUE : FALSE;
+	if(is_x_major == TRUE)
 	{
-		//Since horizontal width is greater than vertical, incremental step will calculated from horizontal
-		if(x_width >= 0)
-		{
-			//Line will increase x
-			for(i = 0; i < x_abs; i++)
-			{
-				delta = (i * y_width) / x_width;
-				GraphicDriver_DrawPoint(x_start + i, y_start + delta, color);
-			}
-		}
-		else
-		{
-			//Line will decrease x
-			for(i = 0; i < x_abs; i++)
-			{
-				delta = (i * y_width) / x_abs;
-				GraphicDriver_DrawPoint(x_start - i, y_start + delta, color);
-			}
-		}
+		//Horizontal width is greater than vertical, x is incremented every step
+		major = ABS(x_width);
+		minor = ABS(y_width);
+		minor_sign = ( (x_width > 0) == (y_width > 0) ) ? 1 : -1;
+		major_first = MIN(x_first, x_last);
+		minor_first = (x_width < 0) ? y_last : y_first;
+		major_clip_start = ClipXStart[ClipDepth];
+		major_clip_end = ClipXEnd[ClipDepth];
+		minor_clip_start = ClipYStart[ClipDepth];
+		minor_clip_end = ClipYEnd[ClipDepth];
+		x_major_step = 1;
+		y_minor_step = minor_sign;
 	}
 	else
 	{
-		//Since vertical width is greater than horizontal, incremental step will calculated from vertical
-		if(y_width >= 0)
-		{
-			//Line will increase y
-			for(i = 0; i < y_abs; i++)
-			{
-				delta = (i * x_width) / y_width;
-				GraphicDriver_DrawPoint(x_start + delta, y_start + i, color);
-			}
-		}
-		else
+		//Vertical width is greater than horizontal or equal, y is incremented every step
+		major = ABS(y_width);
+		minor = ABS(x_width);
+		minor_sign = ( (y_width > 0) == (x_width > 0) ) ? 1 : -1;
+		major_first = MIN(y_first, y_last);
+		minor_first = (y_width < 0) ? x_last : x_first;
+		major_clip_start = ClipYStart[ClipDepth];
+		major_clip_end = ClipYEnd[ClipDepth];
+		minor_clip_start = ClipXStart[ClipDepth];
+		minor_clip_end = ClipXEnd[ClipDepth];
+		y_major_step = 1;
+		x_minor_step = minor_sign;
+	}
+
+	//Pixel of step k lies at major_first + k along major axis, excluded end point is step 0 when line is rasterized from its end
+	step = ( (is_x_major == TRUE) ? (x_width < 0) : (y_width < 0) ) ? 1 : 0;
+	step_end = step + major;
+
+	//Steps within clip along major axis
+	step = MAX(step, major_clip_start - major_first);
+	step_end = MIN(step_end, major_clip_end - major_first);
+
+	//Steps within clip along minor axis, minor offset grows with step
+	if(minor_sign > 0)
+	{
+		step = MAX(step, Graphics_GetLineStep(major, minor, minor_clip_start - minor_first));
+		step_end = MIN(step_end, Graphics_GetLineStep(major, minor, minor_clip_end - minor_first));
+	}
+	else
+	{
+		step = MAX(step, Graphics_GetLineStep(major, minor, minor_first - minor_clip_end + 1));
+		step_end = MIN(step_end, Graphics_GetLineStep(major, minor, minor_first - minor_clip_start + 1));
+	}
+
+	if(step >= step_end)
+	{
+		return;
+	}
+
+	//Error is distance to the ideal line scaled by 2 * major, minor axis steps once it is past half a pixel
+	minor_steps = (2LL * minor * step + major - 1) / (2 * major);
+	error = (int)(2LL * minor * (step + 1) - major - 2LL * major * minor_steps);
+	x = (is_x_major == TRUE) ? major_first + step : minor_first + minor_sign * (int)minor_steps;
+	y = (is_x_major == TRUE) ? minor_first + minor_sign * (int)minor_steps : major_first + step;
+
+	for(; step < step_end; step++)
+	{
+		GraphicDriver_DrawPoint(x, y, color);
+
+		if(error > 0)
 		{
-			//Line will decrease y
-			for(i = 0; i < y_abs; i++)
-			{
-				delta = (i * x_width) / y_width;
-				GraphicDriver_DrawPoint(x_start + delta, y_start - i, color);
-			}
+			x += x_minor_step;
+			y += y_minor_step;
+			error -= 2 * major;
 		}
+		error += 2 * minor;
+		x += x_major_step;
+		y += y_major_step;
+	}
+}
+
+/**
+ * @brief Get first Bresenham step whose pixel lies offset or more pixels along minor axis from the first one
+ *
+ * @details Step k lies (2 * minor * k + major - 1) / (2 * major) pixels along minor axis.
+ *
+ * @return major + 1 when no step of the line gets that far
+ */
+int Graphics_GetLineStep(int major, int minor, int offset)
+{
+	if(offset <= 0)
+	{
+		return 0;
+	}
+	if(offset > minor)
+	{
+		return major + 1;
+	}
+	return (int)( (2LL * major * offset - major + 2 * minor) / (2 * minor) );
+}
+
+/**
+ * @brief Set clip entry 0 to the screen, its size follows rotation and selected display
+ *
+ * @details Current clip pushed before the screen got smaller is trimmed too, start is kept not above end.
+ */
+void Graphics_ClipToScreen(void)
+{
+	unsigned short width = GraphicDriver_GetWidth();
+	unsigned short height = GraphicDriver_GetHeight();
+
+	ClipXEnd[0] = width;
+	ClipYEnd[0] = height;
+	ClipXEnd[ClipDepth] = MAX( ClipXStart[ClipDepth], MIN(ClipXEnd[ClipDepth], width) );
+	ClipYEnd[ClipDepth] = MAX( ClipYStart[ClipDepth], MIN(ClipYEnd[ClipDepth], height) );
+}
+
+/**
+ * @brief Fill rectangle given by signed corners, x_end and y_end excluded, trimmed to clip rectangle
+ */
+void Graphics_FillClipped(int x_start, int y_start, int x_end, int y_end, unsigned int color)
+{
+	x_start = MAX(x_start, (int)ClipXStart[ClipDepth]);
+	y_start = MAX(y_start, (int)ClipYStart[ClipDepth]);
+	x_end = MIN(x_end, (int)ClipXEnd[ClipDepth]);
+	y_end = MIN(y_end, (int)ClipYEnd[ClipDepth]);
+
+	if( (x_end > x_start) && (y_end > y_start) )
+	{
+		GraphicDriver_FillRect(x_start, y_start, x_end - x_start, y_end - y_start, color);
 	}
 }
 
 /**
  * @brief Draw ASCII character at defined coordinated with defined color
  *
+ * @details Coordinates greater than 0x7FFF are taken as negative ones wrapped around, like in Graphics_DrawString.
+ *
  * @param x - x coordinate of leftmost corner to start drawing character
  * @param y - y coordinate of topmost corner to start drawing character
  * @param ascii_char - ASCII code character
@@ -120,66 +354,448 @@ void Graphics_DrawLine(unsigned short x_start,
  */
 void Graphics_DrawChar(unsigned short x, unsigned short y, unsigned char ascii_char, FONT_SIZE_TYPE font_size, unsigned int color)
 {
-	unsigned char height_index = 0, width_index = 0, font_height = 0, font_width = 0;
-	unsigned short font_row, ascii_table_index;
+	const FONT_TYPE *Font = Fonts_GetFont(font_size);
 
-	if( (font_size == FONT_8P) || (font_size == FONT_8P_BOLD) )
+	Graphics_ClipToScreen();
+	if(Font != NULL)
 	{
-		font_height = FONT_8P_HEIGHT;
-		font_width = FONT_8P_WIDTH;
+		Graphics_DrawGlyph(GRAPHICS_SIGNED(x), GRAPHICS_SIGNED(y) + 1, Font, ascii_char, color);
 	}
-	else if(font_size == FONT_12P)
+}
+
+/**
+ * @brief Draw ASCII character with its background, whole character cell is written
+ *
+ * @param x - x coordinate of leftmost corner to start drawing character
+ * @param y - y coordinate of topmost corner to start drawing character
+ * @param ascii_char - ASCII code character
+ * @param font_size - FONT_SIZE_TYPE enumerated parameter defined in Fonts.h file
+ * @param color - R5 G6 B5 glyph color
+ * @param background - R5 G6 B5 color of cell pixels not in glyph
+ */
+void Graphics_DrawCharOpaque(unsigned short x,
+							unsigned short y,
+							unsigned char ascii_char,
+							FONT_SIZE_TYPE font_size,
+							unsigned int color,
+							unsigned int background)
+{
+	char string[1];
+
+	string[0] = (char)ascii_char;
+	Graphics_DrawString(x, y, string, 1, font_size, color, background, GRAPHICS_TEXT_OPAQUE);
+}
+
+/**
+ * @brief Draw run of characters, one next to another
+ *
+ * @details Font is resolved and extent of the run is laid out once. With GRAPHICS_TEXT_OPAQUE the clipped run
+ * is streamed through one driver window, glyph and background pixels together, row by row, so text drawn over
+ * a background needs no clear before and old text under it is erased. Otherwise only glyph pixels are drawn,
+ * each glyph row as one mask.
+ *
+ * Coordinates greater than 0x7FFF are taken as negative ones wrapped around, so run starting left of the
+ * screen or above it shows its visible part.
+ *
+ * @param x - x coordinate of leftmost corner of first character
+ * @param y - y coordinate like in Graphics_DrawChar
+ * @param string - characters to draw
+ * @param length - number of characters to draw, string end stops drawing sooner, GRAPHICS_TEXT_TO_END for whole string
+ * @param font_size - FONT_SIZE_TYPE enumerated parameter defined in Fonts.h file
+ * @param color - R5 G6 B5 glyph color
+ * @param background - R5 G6 B5 color of cell pixels not in glyph, used with GRAPHICS_TEXT_OPAQUE only
+ * @param flags - GRAPHICS_TEXT_TRANSPARENT or GRAPHICS_TEXT_OPAQUE
+ */
+void Graphics_DrawString(unsigned short x,
+						unsigned short y,
+						const char *string,
+						unsigned short length,
+						FONT_SIZE_TYPE font_size,
+						unsigned int color,
+						unsigned int background,
+						unsigned char flags)
+{
+	const FONT_TYPE *Font = Fonts_GetFont(font_size);
+	int x_left, y_top;
+	unsigned short count, i;
+
+	if(Font == NULL)
 	{
-		font_height = FONT_12P_HEIGHT;
-		font_width = FONT_12P_WIDTH;
+		return;
 	}
-	else if(font_size == FONT_16P)
+
+	count = 0;
+	while( (count < length) && (string[count] != '\0') )
 	{
-		font_height = FONT_16P_HEIGHT;
-		font_width = FONT_16P_WIDTH;
+		count++;
 	}
+	Graphics_ClipToScreen();
 
-	y += font_height;
+	//Run spans rows y + 1 to y + Height
+	x_left = GRAPHICS_SIGNED(x);
+	y_top = GRAPHICS_SIGNED(y) + 1;
 
-	ascii_table_index = (ascii_char - 32) * font_height;
+	if( (flags & GRAPHICS_TEXT_OPAQUE) == 0 )
+	{
+		for(i = 0; i < count; i++, x_left += Font->Width)
+		{
+			Graphics_DrawGlyph(x_left, y_top, Font, string[i], color);
+		}
+		return;
+	}
 
-	for(height_index = 0; height_index < font_height; height_index++)
+#if (GRAPHICS_GLYPH_CACHE_SIZE != 0)
+	//Wholly visible characters are blitted from glyph cache one window each, the others are rasterized
+	for(i = 0; i < count; i++, x_left += Font->Width)
 	{
-		for(width_index = 0; width_index < font_width; width_index++)
+		if(Graphics_DrawCachedGlyph(x_left, y_top, Font, font_size, string[i], color, background) == FALSE)
 		{
-			if(font_size == FONT_16P)
-			{
-				font_row = Font_16p_Ascii_Table[ascii_table_index + height_index];
-				if( (font_row & (0x01 << width_index)) != 0x0000 )
-				{
-					GraphicDriver_DrawPoint(x + width_index, y - height_index, color);
-				}
-			}
-			else if(font_size == FONT_12P)
-			{
-				font_row = Font_12p_Ascii_Table[ascii_table_index + height_index];
-				if( (font_row & (0x8000 >> width_index)) != 0x0000 )
-				{
-					GraphicDriver_DrawPoint(x + width_index, y - height_index, color);
-				}
-			}
-			else if(font_size == FONT_8P_BOLD)
+			Graphics_DrawRunOpaque(x_left, y_top, &string[i], 1, Font, color, background);
+		}
+	}
+#else
+	Graphics_DrawRunOpaque(x_left, y_top, string, count, Font, color, background);
+#endif
+}
+
+/**
+ * @brief Stream clipped run of character cells through one driver window, row by row
+ *
+ * @details Window is not clipped by driver, clip rectangle keeps it on the screen.
+ *
+ * @param x_left - leftmost column of first character, may be left of the screen
+ * @param y_top - top row of the run, may be above the screen
+ */
+void Graphics_DrawRunOpaque(int x_left,
+							int y_top,
+							const char *string,
+							unsigned short count,
+							const FONT_TYPE *Font,
+							unsigned int color,
+							unsigned int background)
+{
+	FONT_READER_TYPE Reader;
+	unsigned short pixels[32];
+	int x_start, y_start, x_end, y_end, row, column;
+	unsigned short first_char, first_offset, offset, pixel_count, i, j;
+	unsigned long mask;
+
+	//Packed glyphs are only read row after row, so every character gets a window of its own
+	if( (Font->PackedRows != NULL) && (count > 1) )
+	{
+		for(i = 0; i < count; i++, x_left += Font->Width)
+		{
+			Graphics_DrawRunOpaque(x_left, y_top, &string[i], 1, Font, color, background);
+		}
+		return;
+	}
+
+	x_start = MAX(x_left, (int)ClipXStart[ClipDepth]);
+	y_start = MAX(y_top, (int)ClipYStart[ClipDepth]);
+	x_end = MIN(x_left + count * Font->Width, (int)ClipXEnd[ClipDepth]);
+	y_end = MIN(y_top + Font->Height, (int)ClipYEnd[ClipDepth]);
+
+	if( (x_end <= x_start) || (y_end <= y_start) )
+	{
+		return;
+	}
+
+	//First visible character and its first visible column
+	first_char = (x_start - x_left) / Font->Width;
+	first_offset = (x_start - x_left) % Font->Width;
+
+	//Single character is read from its top row, rows above clip are skipped
+	if(count == 1)
+	{
+		Fonts_OpenGlyph(&Reader, Font, string[0]);
+		for(row = y_top; row < y_start; row++)
+		{
+			Fonts_ReadRow(&Reader);
+		}
+	}
+
+	GraphicDriver_BeginWindow(x_start, y_start, x_end - 1, y_end - 1);
+	for(row = y_start; row < y_end; row++)
+	{
+		for(column = x_start, i = first_char, offset = first_offset; column < x_end; column += pixel_count, i++, offset = 0)
+		{
+			//Glyph row 0 is the bottom row of the cell
+			mask = (count == 1) ? Fonts_ReadRow(&Reader) : Fonts_GetRow(Font, string[i], y_top + Font->Height - 1 - row);
+			mask >>= offset;
+			pixel_count = MIN(Font->Width - offset, x_end - column);
+
+			for(j = 0; j < pixel_count; j++, mask >>= 1)
 			{
-				font_row = Font_8p_bold_Ascii_Table[ascii_table_index + height_index];
-				if( (font_row & (0x80 >> width_index)) != 0x0000 )
-				{
-					GraphicDriver_DrawPoint(x + width_index, y - height_index, color);
-				}
+				pixels[j] = ( (mask & 0x01) != 0 ) ? color : background;
 			}
-			else if(font_size == FONT_8P)
+			GraphicDriver_PushPixels(pixels, pixel_count);
+		}
+	}
+	GraphicDriver_EndWindow();
+}
+
+#if (GRAPHICS_GLYPH_CACHE_SIZE != 0)
+/**
+ * @brief Get glyph cache statistics, hits and misses since reset and current occupancy
+ */
+GRAPHICS_GLYPH_CACHE_STATS_TYPE Graphics_GetGlyphCacheStats(void)
+{
+	GRAPHICS_GLYPH_CACHE_STATS_TYPE stats;
+
+	stats.Hits = GlyphCacheHits;
+	stats.Misses = GlyphCacheMisses;
+	stats.Evictions = GlyphCacheEvictions;
+	stats.Glyphs = GlyphCacheCount;
+	stats.Bytes = GlyphCacheBytes;
+	return stats;
+}
+
+/**
+ * @brief Clear glyph cache hit, miss and eviction counters
+ */
+void Graphics_ResetGlyphCacheStats(void)
+{
+	GlyphCacheHits = 0;
+	GlyphCacheMisses = 0;
+	GlyphCacheEvictions = 0;
+}
+
+/**
+ * @brief Drop all cached glyphs, e.g. after PixelFormat_SetPalette changed what cached pixel values mean
+ */
+void Graphics_ClearGlyphCache(void)
+{
+	GlyphCacheCount = 0;
+	GlyphCacheBytes = 0;
+}
+
+/**
+ * @brief Blit wholly visible character cell from glyph cache, expanding it into the cache first on miss
+ *
+ * @return FALSE if cell is clipped or does not fit in the cache, nothing is drawn and caller has to draw the cell itself
+ */
+bool Graphics_DrawCachedGlyph(int x_left,
+							int y_top,
+							const FONT_TYPE *Font,
+							FONT_SIZE_TYPE font_size,
+							unsigned char ascii_char,
+							unsigned int color,
+							unsigned int background)
+{
+	const PIXEL_FORMAT_KERNELS_TYPE *Format = GraphicDriver_GetPixelFormat();
+	const unsigned char *pixels;
+	unsigned int stride, row;
+
+	if( (x_left < ClipXStart[ClipDepth]) || (y_top < ClipYStart[ClipDepth]) ||
+		(x_left + Font->Width > ClipXEnd[ClipDepth]) || (y_top + Font->Height > ClipYEnd[ClipDepth]) )
+	{
+		return FALSE;
+	}
+
+	pixels = Graphics_GetCachedGlyph(Font, font_size, ascii_char, color, background, Format);
+	if(pixels == NULL)
+	{
+		return FALSE;
+	}
+
+	GraphicDriver_BeginWindow(x_left, y_top, x_left + Font->Width - 1, y_top + Font->Height - 1);
+	stride = PixelFormat_GetBytes(Format, Font->Width);
+	if(stride * 8 == (unsigned int)Font->Width * Format->BitsPerPixel)
+	{
+		//Rows are contiguous, whole cell is one stream
+		GraphicDriver_PushNative(pixels, Font->Width * Font->Height);
+	}
+	else
+	{
+		for(row = 0; row < Font->Height; row++, pixels += stride)
+		{
+			GraphicDriver_PushNative(pixels, Font->Width);
+		}
+	}
+	GraphicDriver_EndWindow();
+
+	return TRUE;
+}
+
+/**
+ * @brief Find glyph in cache, expand it on miss, evicting least recently used glyphs until it fits
+ *
+ * @details Cached glyphs are kept packed at the start of the pool in order of their entries, eviction moves
+ * the following ones down. Rows are stored top row first, each starting on a byte.
+ *
+ * @return pixel data in display pixel format, NULL if glyph is bigger than the cache
+ */
+const unsigned char* Graphics_GetCachedGlyph(const FONT_TYPE *Font,
+											FONT_SIZE_TYPE font_size,
+											unsigned char ascii_char,
+											unsigned int color,
+											unsigned int background,
+											const PIXEL_FORMAT_KERNELS_TYPE *Format)
+{
+	FONT_READER_TYPE Reader;
+	unsigned char *pool = (unsigned char *)GlyphCachePool;
+	unsigned char *pixels;
+	unsigned int stride, size, row, i, lru, evicted;
+
+	GlyphCacheClock++;
+
+	for(i = 0; i < GlyphCacheCount; i++)
+	{
+		if( (GlyphCache[i].Format == Format) && (GlyphCache[i].FontSize == font_size) && (GlyphCache[i].Char == ascii_char) &&
+			(GlyphCache[i].Color == color) && (GlyphCache[i].Background == background) )
+		{
+			GlyphCacheHits++;
+			GlyphCache[i].LastUse = GlyphCacheClock;
+			return &pool[GlyphCache[i].Offset];
+		}
+	}
+
+	GlyphCacheMisses++;
+
+	//Size kept a multiple of 4, so every glyph starts aligned for pixel format kernels
+	stride = PixelFormat_GetBytes(Format, Font->Width);
+	size = (stride * Font->Height + 3) & ~3U;
+	if(size > sizeof(GlyphCachePool))
+	{
+		return NULL;
+	}
+
+	while( (GlyphCacheCount >= GRAPHICS_GLYPH_CACHE_ENTRIES) || (GlyphCacheBytes + size > sizeof(GlyphCachePool)) )
+	{
+		for(lru = 0, i = 1; i < GlyphCacheCount; i++)
+		{
+			if(GlyphCache[i].LastUse < GlyphCache[lru].LastUse)
 			{
-				font_row = Font_8p_Ascii_Table[ascii_table_index + height_index];
-				if( (font_row & (0x80 >> width_index)) != 0x0000 )
-				{
-					GraphicDriver_DrawPoint(x + width_index, y - height_index, color);
-				}
+				lru = i;
 			}
 		}
+
+		evicted = GlyphCache[lru].Size;
+		memmove(&pool[GlyphCache[lru].Offset],
+				&pool[GlyphCache[lru].Offset + evicted],
+				GlyphCacheBytes - GlyphCache[lru].Offset - evicted);
+		GlyphCacheBytes -= evicted;
+		for(i = lru + 1; i < GlyphCacheCount; i++)
+		{
+			GlyphCache[i - 1] = GlyphCache[i];
+			GlyphCache[i - 1].Offset -= evicted;
+		}
+		GlyphCacheCount--;
+		GlyphCacheEvictions++;
 	}
+
+	i = GlyphCacheCount++;
+	GlyphCache[i].Format = Format;
+	GlyphCache[i].FontSize = font_size;
+	GlyphCache[i].Char = ascii_char;
+	GlyphCache[i].Color = color;
+	GlyphCache[i].Background = background;
+	GlyphCache[i].Offset = GlyphCacheBytes;
+	GlyphCache[i].Size = size;
+	GlyphCache[i].LastUse = GlyphCacheClock;
+	GlyphCacheBytes += size;
+
+	pixels = &pool[GlyphCache[i].Offset];
+	Fonts_OpenGlyph(&Reader, Font, ascii_char);
+	for(row = 0; row < Font->Height; row++, pixels += stride)
+	{
+		Format->Fill(pixels, 0, Font->Width, Format->FromRgb565(background));
+		Format->Blit(pixels, 0, Fonts_ReadRow(&Reader), Font->Width, Format->FromRgb565(color));
+	}
+
+	return &pool[GlyphCache[i].Offset];
 }
+#endif
+
+/**
+ * @brief Get width of font character cell
+ *
+ * @return 0 for unknown font
+ */
+unsigned short Graphics_GetFontWidth(FONT_SIZE_TYPE font_size)
+{
+	const FONT_TYPE *Font = Fonts_GetFont(font_size);
+
+	return (Font != NULL) ? Font->Width : 0;
+}
+
+/**
+ * @brief Get height of font character cell
+ *
+ * @return 0 for unknown font
+ */
+unsigned short Graphics_GetFontHeight(FONT_SIZE_TYPE font_size)
+{
+	const FONT_TYPE *Font = Fonts_GetFont(font_size);
 
+	return (Font != NULL) ? Font->Height : 0;
+}
+
+/**
+ * @brief Draw glyph pixels of character, every glyph row as one mask
+ *
+ * @details Driver writes each run of set bits in a row as one span.
+ *
+ * @param x_left - leftmost column of character cell, may be left of the screen
+ * @param y_top - top row of character cell, may be above the screen
+ */
+void Graphics_DrawGlyph(int x_left, int y_top, const FONT_TYPE *Font, unsigned char ascii_char, unsigned int color)
+{
+	FONT_READER_TYPE Reader;
+	unsigned long mask;
+	int row;
+
+	//Glyph wholly outside clip is rejected
+	if( (x_left >= ClipXEnd[ClipDepth]) || (x_left + Font->Width <= ClipXStart[ClipDepth]) ||
+		(y_top >= ClipYEnd[ClipDepth]) || (y_top + Font->Height <= ClipYStart[ClipDepth]) )
+	{
+		return;
+	}
+
+	//Rows are read top one first
+	Fonts_OpenGlyph(&Reader, Font, ascii_char);
+	for(row = y_top; row < y_top + Font->Height; row++)
+	{
+		mask = Fonts_ReadRow(&Reader);
+		if( (mask != 0) && (row >= ClipYStart[ClipDepth]) && (row < ClipYEnd[ClipDepth]) )
+		{
+			Graphics_DrawMaskClipped(x_left, row, Font->Width, mask, color);
+		}
+	}
+}
+
+/**
+ * @brief Draw one row mask trimmed to clip columns, row is already known to be within clip
+ *
+ * @param x - column of pixel in bit 0 of mask, may be left of the screen
+ * @param y - row to draw
+ * @param width - number of mask bits used
+ * @param mask - set bits are drawn, leftmost pixel in bit 0
+ * @param color - R5 G6 B5 unit color data
+ */
+void Graphics_DrawMaskClipped(int x, int y, unsigned short width, unsigned long mask, unsigned int color)
+{
+	int skipped;
+
+	if(x < ClipXStart[ClipDepth])
+	{
+		skipped = ClipXStart[ClipDepth] - x;
+		if(skipped >= width)
+		{
+			return;
+		}
+		mask >>= skipped;
+		width -= skipped;
+		x = ClipXStart[ClipDepth];
+	}
+	if(x >= ClipXEnd[ClipDepth])
+	{
+		return;
+	}
+	if(width > ClipXEnd[ClipDepth] - x)
+	{
+		width = ClipXEnd[ClipDepth] - x;
+	}
+
+	GraphicDriver_DrawMask(x, y, width, mask, color);
+}
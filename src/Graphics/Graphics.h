@@ -15,12 +15,52 @@
 #ifndef GRAPHICS_H_
 #define GRAPHICS_H_
 
+#include "../Typedefs.h"
 #include "../GraphicDriver/GraphicDriver.h"
 #include "../Fonts.h"
 
 //! @def Macro for calculating absolute value
 #define ABS(X) 		 ((X) > 0 ? (X) : -(X))
 
+//! @def Macros for calculating lower and greater of two values
+#define MIN(A, B)		 ((A) < (B) ? (A) : (B))
+#define MAX(A, B)		 ((A) > (B) ? (A) : (B))
+
+//! Graphics_DrawString flag, only glyph pixels are drawn
+#define GRAPHICS_TEXT_TRANSPARENT	0x00
+
+//! Graphics_DrawString flag, whole character cells are drawn, pixels not in glyph with background color
+#define GRAPHICS_TEXT_OPAQUE		0x01
+
+//! Graphics_DrawString length drawing the whole string
+#define GRAPHICS_TEXT_TO_END		0xFFFF
+
+//! Bytes of RAM for glyph cache of opaque text, glyphs expanded to display pixel format. A 16x24 glyph takes
+//! 768 bytes at 16 bits per pixel, an 8x12 one 192 bytes. Set to 0 to compile glyph cache out.
+#ifndef GRAPHICS_GLYPH_CACHE_SIZE
+#define GRAPHICS_GLYPH_CACHE_SIZE	0
+#endif
+
+//! Maximum number of glyphs in glyph cache
+#ifndef GRAPHICS_GLYPH_CACHE_ENTRIES
+#define GRAPHICS_GLYPH_CACHE_ENTRIES	32
+#endif
+
+//! Glyph cache statistics
+typedef struct
+{
+	unsigned long Hits;			//!< Glyphs drawn from cache
+	unsigned long Misses;		//!< Glyphs expanded into cache
+	unsigned long Evictions;	//!< Glyphs evicted to make room
+	unsigned short Glyphs;		//!< Glyphs cached now
+	unsigned int Bytes;			//!< Cache bytes in use now
+} GRAPHICS_GLYPH_CACHE_STATS_TYPE;
+
+//! Maximum number of nested clip rectangles pushed with Graphics_PushClip
+#ifndef GRAPHICS_CLIP_DEPTH
+#define GRAPHICS_CLIP_DEPTH		8
+#endif
+
 
 void Graphics_DrawRect(unsigned short x_start,
 						unsigned short y_start,
@@ -36,4 +76,32 @@ void Graphics_DrawLine(unsigned short x_start,
 
 void Graphics_DrawChar(unsigned short x, unsigned short y, unsigned char ascii_char, FONT_SIZE_TYPE font, unsigned int color);
 
+void Graphics_DrawCharOpaque(unsigned short x,
+							unsigned short y,
+							unsigned char ascii_char,
+							FONT_SIZE_TYPE font,
+							unsigned int color,
+							unsigned int background);
+
+void Graphics_DrawString(unsigned short x,
+						unsigned short y,
+						const char *string,
+						unsigned short length,
+						FONT_SIZE_TYPE font,
+						unsigned int color,
+						unsigned int background,
+						unsigned char flags);
+
+unsigned short Graphics_GetFontWidth(FONT_SIZE_TYPE font);
+unsigned short Graphics_GetFontHeight(FONT_SIZE_TYPE font);
+
+#if (GRAPHICS_GLYPH_CACHE_SIZE != 0)
+GRAPHICS_GLYPH_CACHE_STATS_TYPE Graphics_GetGlyphCacheStats(void);
+void Graphics_ResetGlyphCacheStats(void);
+void Graphics_ClearGlyphCache(void);
+#endif
+
+bool Graphics_PushClip(unsigned short x, unsigned short y, unsigned short width, unsigned short height);
+void Graphics_PopClip(void);
+
 #endif /* GRAPHICS_H_ */
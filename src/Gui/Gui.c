@@ -29,6 +29,18 @@ static char StringData[GUI_TEXTBOX_MAX_SIZE];
 //! Backup buffer for string in TextBox
 static char buff[GUI_TEXTBOX_MAX_SIZE];
 
+//! Id of Button that is currently pressed, 0 if none
+static unsigned char SelectedButtonId = 0;
+
+//! Hook reporting entry and exit of drawing functions, NULL if none
+static GUI_DRAW_HOOK_TYPE DrawHook = NULL;
+
+//! Clock Gui_TaskViews measures its time budget with, NULL if none
+static GUI_CLOCK_TYPE Clock = NULL;
+
+//! Index of View Gui_TaskViews services next among those not on touchscreen display
+static unsigned char NextView = 0;
+
 static void Gui_DeleteButtonList(GUI_VIEW_TYPE *View);
 static void Gui_DeleteLabelList(GUI_VIEW_TYPE *View);
 static void Gui_DeleteSliderList(GUI_VIEW_TYPE *View);
@@ -45,6 +57,24 @@ static void Gui_ScanCheckbox(GUI_CHECKBOX_LIST_TYPE *CheckboxList);
 static void Gui_ScanTextBox(GUI_TEXTBOX_TYPE *TextBox);
 static char *Gui_itoa(int i, char *s);
 static void Gui_RefreshGraph(GUI_GRAPH_TYPE *Graph);
+static void Gui_DrawViewElements(GUI_VIEW_TYPE *View);
+static void Gui_RenderBands(GUI_VIEW_TYPE *View, unsigned short y_start, unsigned short y_end);
+static void Gui_BeginDraw(const char *name, GRAPHIC_DRIVER_CALLER_TYPE caller);
+static void Gui_EndDraw(void);
+static GRAPHIC_DRIVER_DISPLAY_TYPE* Gui_SelectDisplay(GUI_VIEW_TYPE *View);
+static bool Gui_IsTouchView(GUI_VIEW_TYPE *View);
+static unsigned char Gui_GetTextOffset(FONT_SIZE_TYPE font);
+static void Gui_DrawTextOnBackground(unsigned short x_start,
+									unsigned short y_start,
+									unsigned short x_end,
+									unsigned short y_end,
+									int x,
+									int y,
+									char *string,
+									unsigned short length,
+									FONT_SIZE_TYPE font,
+									unsigned int color,
+									unsigned int background);
 
 /**
  * @brief Draw a Label type element
@@ -53,8 +83,21 @@ static void Gui_RefreshGraph(GUI_GRAPH_TYPE *Graph);
  */
 void Gui_DrawLabel(GUI_LABEL_TYPE *Label)
 {
-	unsigned short x_step = 0;
-	unsigned char i = 0;
+	unsigned short length = 0;
+	int x_step = 0;
+
+	Gui_BeginDraw("Gui_DrawLabel", CALLER_LABEL);
+
+	//Text run is laid out once, the same way for every font
+	length = Gui_GetStringLength(Label->String);
+	if(Label->Align == ALIGN_RIGHT)
+	{
+		x_step = Label->Width - (Graphics_GetFontWidth(Label->FontSize) * length);
+	}
+	else if(Label->Align == ALIGN_CENTER)
+	{
+		x_step = Label->Width/2 - (Graphics_GetFontWidth(Label->FontSize) * length / 2);
+	}
 
 	if(Label->IsBackground == TRUE)
 	{
@@ -83,110 +126,35 @@ void Gui_DrawLabel(GUI_LABEL_TYPE *Label)
 						Label->YPos + Label->Height,
 						0x0000);
 
-		//Draw a background Label with a button shape
-		Graphics_DrawRect(Label->XPos + 1,
-						Label->YPos + 1,
-						Label->XPos + Label->Width - 1,
-						Label->YPos + Label->Height - 1,
-						Label->BackgroundColor);
+		//Draw text over a background Label with a button shape
+		Gui_DrawTextOnBackground(Label->XPos + 1,
+								Label->YPos + 1,
+								Label->XPos + Label->Width - 1,
+								Label->YPos + Label->Height - 1,
+								Label->XPos + x_step,
+								Label->YPos - Gui_GetTextOffset(Label->FontSize),
+								Label->String,
+								length,
+								Label->FontSize,
+								Label->FontColor,
+								Label->BackgroundColor);
 	}
-
-	if(Label->FontSize == FONT_16P)
-	{
-		if(Label->Align == ALIGN_LEFT)
-		{
-			for(x_step = 0, i = 0; Label->String[i] != '\0'; x_step += FONT_16P_WIDTH, i++)
-			{
-				Graphics_DrawChar(Label->XPos + x_step, Label->YPos - 4, Label->String[i], FONT_16P, Label->FontColor);
-			}
-		}
-		else if(Label->Align == ALIGN_RIGHT)
-		{
-			for(x_step = Label->Width - (FONT_16P_WIDTH * Gui_GetStringLength(Label->String)), i = 0; Label->String[i] != '\0'; x_step += FONT_16P_WIDTH, i++)
-			{
-				Graphics_DrawChar(Label->XPos + x_step, Label->YPos - 4, Label->String[i], FONT_16P, Label->FontColor);
-			}
-		}
-		else if(Label->Align == ALIGN_CENTER)
-		{
-			for(x_step = Label->Width/2 - (FONT_16P_WIDTH * Gui_GetStringLength(Label->String) / 2), i = 0; Label->String[i] != '\0'; x_step += FONT_16P_WIDTH, i++)
-			{
-				Graphics_DrawChar(Label->XPos + x_step, Label->YPos - 4, Label->String[i], FONT_16P, Label->FontColor);
-			}
-		}
-	}
-	else if(Label->FontSize == FONT_12P)
-	{
-		if(Label->Align == ALIGN_LEFT)
-		{
-			for(x_step = 0, i = 0; Label->String[i] != '\0'; x_step += FONT_12P_WIDTH, i++)
-			{
-				Graphics_DrawChar(Label->XPos + x_step, Label->YPos - 2, Label->String[i], FONT_12P, Label->FontColor);
-			}
-		}
-		else if(Label->Align == ALIGN_RIGHT)
-		{
-			for(x_step = Label->Width - (FONT_12P_WIDTH * Gui_GetStringLength(Label->String)), i = 0; Label->String[i] != '\0'; x_step += FONT_12P_WIDTH, i++)
-			{
-				Graphics_DrawChar(Label->XPos + x_step, Label->YPos - 2, Label->String[i], FONT_12P, Label->FontColor);
-			}
-		}
-		else if(Label->Align == ALIGN_CENTER)
-		{
-			for(x_step = Label->Width/2 - (FONT_12P_WIDTH * Gui_GetStringLength(Label->String) / 2), i = 0; Label->String[i] != '\0'; x_step += FONT_12P_WIDTH, i++)
-			{
-				Graphics_DrawChar(Label->XPos + x_step, Label->YPos - 2, Label->String[i], FONT_12P, Label->FontColor);
-			}
-		}
-	}
-	else if(Label->FontSize == FONT_8P)
-	{
-		if(Label->Align == ALIGN_LEFT)
-		{
-			for(x_step = 0, i = 0; Label->String[i] != '\0'; x_step += FONT_8P_WIDTH, i++)
-			{
-				Graphics_DrawChar(Label->XPos + x_step, Label->YPos, Label->String[i], FONT_8P, Label->FontColor);
-			}
-		}
-		else if(Label->Align == ALIGN_RIGHT)
-		{
-			for(x_step = Label->Width - (FONT_8P_WIDTH * Gui_GetStringLength(Label->String)), i = 0; Label->String[i] != '\0'; x_step += FONT_8P_WIDTH, i++)
-			{
-				Graphics_DrawChar(Label->XPos + x_step, Label->YPos, Label->String[i], FONT_8P, Label->FontColor);
-			}
-		}
-		else if(Label->Align == ALIGN_CENTER)
-		{
-			for(x_step = Label->Width/2 - (FONT_8P_WIDTH * Gui_GetStringLength(Label->String) / 2), i = 0; Label->String[i] != '\0'; x_step += FONT_8P_WIDTH, i++)
-			{
-				Graphics_DrawChar(Label->XPos + x_step, Label->YPos, Label->String[i], FONT_8P, Label->FontColor);
-			}
-		}
-	}
-	else if(Label->FontSize == FONT_8P_BOLD)
+	else
 	{
-		if(Label->Align == ALIGN_LEFT)
-		{
-			for(x_step = 0, i = 0; Label->String[i] != '\0'; x_step += FONT_8P_WIDTH, i++)
-			{
-				Graphics_DrawChar(Label->XPos + x_step, Label->YPos - 2, Label->String[i], FONT_8P_BOLD, Label->FontColor);
-			}
-		}
-		else if(Label->Align == ALIGN_RIGHT)
-		{
-			for(x_step = Label->Width - (FONT_8P_WIDTH * Gui_GetStringLength(Label->String)), i = 0; Label->String[i] != '\0'; x_step += FONT_8P_WIDTH, i++)
-			{
-				Graphics_DrawChar(Label->XPos + x_step, Label->YPos - 2, Label->String[i], FONT_8P_BOLD, Label->FontColor);
-			}
-		}
-		else if(Label->Align == ALIGN_CENTER)
-		{
-			for(x_step = Label->Width/2 - (FONT_8P_WIDTH * Gui_GetStringLength(Label->String) / 2), i = 0; Label->String[i] != '\0'; x_step += FONT_8P_WIDTH, i++)
-			{
-				Graphics_DrawChar(Label->XPos + x_step, Label->YPos - 2, Label->String[i], FONT_8P_BOLD, Label->FontColor);
-			}
-		}
+		//Text longer than the Label is clipped to its box
+		Graphics_PushClip(Label->XPos, Label->YPos, Label->Width, Label->Height);
+		Graphics_DrawString(Label->XPos + x_step,
+							Label->YPos - Gui_GetTextOffset(Label->FontSize),
+							Label->String,
+							length,
+							Label->FontSize,
+							Label->FontColor,
+							Label->BackgroundColor,
+							GRAPHICS_TEXT_TRANSPARENT);
+		Graphics_PopClip();
 	}
+
+	Gui_EndDraw();
 }
 
 /**
@@ -196,6 +164,12 @@ void Gui_DrawLabel(GUI_LABEL_TYPE *Label)
  */
 void Gui_DrawButton(GUI_BUTTON_TYPE *Button)
 {
+	unsigned short length = 0;
+	int caption_x = 0;
+	int caption_y = 0;
+
+	Gui_BeginDraw("Gui_DrawButton", CALLER_BUTTON);
+
 	//First draw border of a Button
 	Graphics_DrawLine(Button->XPos,
 					Button->YPos,
@@ -221,32 +195,41 @@ void Gui_DrawButton(GUI_BUTTON_TYPE *Button)
 					Button->YPos + Button->Height,
 					0xFFFF);
 
-	//Draw a filler rectangle with a button shape
-	Graphics_DrawRect(Button->XPos + 1,
-					Button->YPos + 1,
-					Button->XPos + Button->Width - 1,
-					Button->YPos + Button->Height - 1,
-					Button->ButtonColor);
-
-	Button->caption.Align = ALIGN_LEFT;
-
 	//Put a caption label directly in the center of button
-	if(Button->caption.FontSize == FONT_16P)
-	{
-		Button->caption.XPos = Button->XPos + Button->Width/2 - (FONT_16P_WIDTH * Gui_GetStringLength(Button->caption.String) / 2);
-		Button->caption.YPos = Button->YPos + Button->Height/2 - FONT_16P_HEIGHT/2;
-	}
-	else if(Button->caption.FontSize == FONT_12P)
-	{
-		Button->caption.XPos = Button->XPos + Button->Width/2 - (FONT_12P_WIDTH * Gui_GetStringLength(Button->caption.String) / 2);
-		Button->caption.YPos = Button->YPos + Button->Height/2 - FONT_12P_HEIGHT/2;
+	Button->caption.Align = ALIGN_LEFT;
+	length = Gui_GetStringLength(Button->caption.String);
+	caption_x = Button->XPos + Button->Width/2 - (Graphics_GetFontWidth(Button->caption.FontSize) * length / 2);
+	caption_y = Button->YPos + Button->Height/2 - Graphics_GetFontHeight(Button->caption.FontSize)/2;
+	Button->caption.XPos = caption_x;
+	Button->caption.YPos = caption_y;
+
+	if(Button->caption.IsBackground == TRUE)
+	{
+		//Draw a filler rectangle with a button shape
+		Graphics_DrawRect(Button->XPos + 1,
+						Button->YPos + 1,
+						Button->XPos + Button->Width - 1,
+						Button->YPos + Button->Height - 1,
+						Button->ButtonColor);
+		Gui_DrawLabel(&Button->caption);
 	}
-	else if( (Button->caption.FontSize == FONT_8P) || (Button->caption.FontSize == FONT_8P_BOLD) )
+	else
 	{
-		Button->caption.XPos = Button->XPos + Button->Width/2 - (FONT_8P_WIDTH * Gui_GetStringLength(Button->caption.String) / 2);
-		Button->caption.YPos = Button->YPos + Button->Height/2 - FONT_8P_HEIGHT/2;
-	}
-	Gui_DrawLabel(&Button->caption);
+		//Caption text is drawn over the button color, filled only around it
+		Gui_DrawTextOnBackground(Button->XPos + 1,
+								Button->YPos + 1,
+								Button->XPos + Button->Width - 1,
+								Button->YPos + Button->Height - 1,
+								caption_x,
+								caption_y - Gui_GetTextOffset(Button->caption.FontSize),
+								Button->caption.String,
+								length,
+								Button->caption.FontSize,
+								Button->caption.FontColor,
+								Button->ButtonColor);
+	}
+
+	Gui_EndDraw();
 }
 
 /**
@@ -256,6 +239,12 @@ void Gui_DrawButton(GUI_BUTTON_TYPE *Button)
  */
 void Gui_DrawSelectedButton(GUI_BUTTON_TYPE *Button)
 {
+	unsigned short length = 0;
+	int caption_x = 0;
+	int caption_y = 0;
+
+	Gui_BeginDraw("Gui_DrawSelectedButton", CALLER_BUTTON);
+
 	//First draw border of a Button
 	Graphics_DrawLine(Button->XPos,
 					Button->YPos,
@@ -305,30 +294,40 @@ void Gui_DrawSelectedButton(GUI_BUTTON_TYPE *Button)
 					Button->YPos + Button->Height - 1,
 					0xFFFF);
 
-	//Draw a filler rectangle with a button shape
-	Graphics_DrawRect(Button->XPos + 2,
-					Button->YPos + 2,
-					Button->XPos + Button->Width - 2,
-					Button->YPos + Button->Height - 2,
-					Button->ButtonColor);
-
 	//Put a caption label directly in the center of button
-	if(Button->caption.FontSize == FONT_16P)
-	{
-		Button->caption.XPos = Button->XPos + Button->Width/2 - (FONT_16P_WIDTH * Gui_GetStringLength(Button->caption.String) / 2) + 1;
-		Button->caption.YPos = Button->YPos + Button->Height/2 - FONT_16P_HEIGHT/2 - 1;
+	length = Gui_GetStringLength(Button->caption.String);
+	caption_x = Button->XPos + Button->Width/2 - (Graphics_GetFontWidth(Button->caption.FontSize) * length / 2) + 1;
+	caption_y = Button->YPos + Button->Height/2 - Graphics_GetFontHeight(Button->caption.FontSize)/2 - 1;
+	Button->caption.XPos = caption_x;
+	Button->caption.YPos = caption_y;
+
+	if(Button->caption.IsBackground == TRUE)
+	{
+		//Draw a filler rectangle with a button shape
+		Graphics_DrawRect(Button->XPos + 2,
+						Button->YPos + 2,
+						Button->XPos + Button->Width - 2,
+						Button->YPos + Button->Height - 2,
+						Button->ButtonColor);
+		Gui_DrawLabel(&Button->caption);
 	}
-	else if(Button->caption.FontSize == FONT_12P)
-	{
-		Button->caption.XPos = Button->XPos + Button->Width/2 - (FONT_12P_WIDTH * Gui_GetStringLength(Button->caption.String) / 2) + 1;
-		Button->caption.YPos = Button->YPos + Button->Height/2 - FONT_12P_HEIGHT/2 - 1;
-	}
-	else if( (Button->caption.FontSize == FONT_8P) || (Button->caption.FontSize == FONT_8P_BOLD) )
+	else
 	{
-		Button->caption.XPos = Button->XPos + Button->Width/2 - (FONT_8P_WIDTH * Gui_GetStringLength(Button->caption.String) / 2) + 1;
-		Button->caption.YPos = Button->YPos + Button->Height/2 - FONT_8P_HEIGHT/2 - 1;
-	}
-	Gui_DrawLabel(&Button->caption);
+		//Caption text is drawn over the button color, filled only around it
+		Gui_DrawTextOnBackground(Button->XPos + 2,
+								Button->YPos + 2,
+								Button->XPos + Button->Width - 2,
+								Button->YPos + Button->Height - 2,
+								caption_x,
+								caption_y - Gui_GetTextOffset(Button->caption.FontSize),
+								Button->caption.String,
+								length,
+								Button->caption.FontSize,
+								Button->caption.FontColor,
+								Button->ButtonColor);
+	}
+
+	Gui_EndDraw();
 }
 
 /**
@@ -349,6 +348,8 @@ void Gui_DrawSlider(GUI_SLIDER_TYPE *Slider)
 	unsigned short slider_center_line_x_end = 0;
 	unsigned short slider_center_line_y_end = 0;
 
+	Gui_BeginDraw("Gui_DrawSlider", CALLER_SLIDER);
+
 	if(Slider->Orientation == HORIZONTAL)
 	{
 		slider_outline_x_start = Slider->XPos + 5;
@@ -460,6 +461,8 @@ void Gui_DrawSlider(GUI_SLIDER_TYPE *Slider)
 						Slider->SliderButton.XEnd,
 						Slider->SliderButton.YEnd,
 						Slider->Color);
+
+	Gui_EndDraw();
 }
 
 /**
@@ -469,6 +472,8 @@ void Gui_DrawSlider(GUI_SLIDER_TYPE *Slider)
  */
 void Gui_DrawCheckbox(GUI_CHECKBOX_TYPE *Checkbox)
 {
+	Gui_BeginDraw("Gui_DrawCheckbox", CALLER_CHECKBOX);
+
 	//Draw outline of two black lines on the left and upper side of checkbox
 	Graphics_DrawLine(Checkbox->XPos,
 						Checkbox->YPos,
@@ -514,6 +519,8 @@ void Gui_DrawCheckbox(GUI_CHECKBOX_TYPE *Checkbox)
 							Checkbox->YPos + Checkbox->Size - 3,
 							0x0000);
 	}
+
+	Gui_EndDraw();
 }
 
 /**
@@ -525,6 +532,8 @@ void Gui_DrawLed(GUI_LED_TYPE *Led)
 {
 	unsigned int color = 0;
 
+	Gui_BeginDraw("Gui_DrawLed", CALLER_LED);
+
 	//Draw outline of two black lines on the left and upper side of checkbox
 	Graphics_DrawLine(Led->XPos,
 						Led->YPos,
@@ -596,6 +605,8 @@ void Gui_DrawLed(GUI_LED_TYPE *Led)
 						Led->XPos + Led->Size - 3,
 						Led->YPos + Led->Size - 3,
 						color);
+
+	Gui_EndDraw();
 }
 
 /**
@@ -605,6 +616,8 @@ void Gui_DrawLed(GUI_LED_TYPE *Led)
  */
 void Gui_DrawPanel(GUI_PANEL_TYPE *Panel)
 {
+	Gui_BeginDraw("Gui_DrawPanel", CALLER_PANEL);
+
 	//Draw border
 	Graphics_DrawLine(Panel->XPos,
 					Panel->YPos,
@@ -636,6 +649,8 @@ void Gui_DrawPanel(GUI_PANEL_TYPE *Panel)
 					Panel->XPos + Panel->Width - 1,
 					Panel->YPos + Panel->Height - 1,
 					Panel->Color);
+
+	Gui_EndDraw();
 }
 
 /**
@@ -645,6 +660,10 @@ void Gui_DrawPanel(GUI_PANEL_TYPE *Panel)
  */
 void Gui_DrawGraph(GUI_GRAPH_TYPE *Graph)
 {
+	unsigned short i = 0;
+
+	Gui_BeginDraw("Gui_DrawGraph", CALLER_GRAPH);
+
 	//Draw Graph outline
 	Graphics_DrawRect(Graph->XPos,
 						Graph->YPos,
@@ -675,6 +694,17 @@ void Gui_DrawGraph(GUI_GRAPH_TYPE *Graph)
 						Graph->XPos - 1,
 						Graph->YPos - 1,
 						0x0000);
+
+	//Draw plot that is currently on the screen, so the Graph can be drawn again without losing it
+	if(Graph->IsPlotted == TRUE)
+	{
+		for(i = 0; i < GUI_NUM_OF_GRAPH_DATA; i++)
+		{
+			GraphicDriver_DrawPoint(Graph->XPos + i, Graph->YPos + Graph->PlotData[i], 0xF800);
+		}
+	}
+
+	Gui_EndDraw();
 }
 
 /**
@@ -691,10 +721,13 @@ void Gui_DrawTextBox(GUI_TEXTBOX_TYPE *TextBox)
 	unsigned char font_width = 0;
 	unsigned char font_height = 0;
 	unsigned char font_gap = 0;
-	unsigned short x_step = 0;
+	unsigned short line_length = 0;
+	unsigned short line_top = 0;
 	unsigned short y_step = 0;
 	unsigned short i = 0;
 
+	Gui_BeginDraw("Gui_DrawTextBox", CALLER_TEXTBOX);
+
 	//Draw border
 	Graphics_DrawLine(TextBox->XPos,
 					TextBox->YPos,
@@ -720,60 +753,75 @@ void Gui_DrawTextBox(GUI_TEXTBOX_TYPE *TextBox)
 					TextBox->YPos + TextBox->Height,
 					0x0000);
 
-	//Draw a background Label with a button shape
-	Graphics_DrawRect(TextBox->XPos + 1,
-					TextBox->YPos + 1,
-					TextBox->XPos + TextBox->Width - 1,
-					TextBox->YPos + TextBox->Height - 1,
-					TextBox->BackgroundColor);
-
-	switch(TextBox->FontSize)
-	{
-	case FONT_8P:
-		font_width = FONT_8P_WIDTH;
-		font_height = FONT_8P_HEIGHT;
-		font_gap = 0;
-		break;
-	case FONT_8P_BOLD:
-		font_width = FONT_8P_WIDTH;
-		font_height = FONT_8P_HEIGHT;
-		font_gap = 2;
-		break;
-	case FONT_12P:
-		font_width = FONT_12P_WIDTH;
-		font_height = FONT_12P_HEIGHT;
-		font_gap = 2;
-		break;
-	case FONT_16P:
-		font_width = FONT_16P_WIDTH;
-		font_height = FONT_16P_HEIGHT;
-		font_gap = 4;
-		break;
-	}
+	font_width = Graphics_GetFontWidth(TextBox->FontSize);
+	font_height = Graphics_GetFontHeight(TextBox->FontSize);
+	font_gap = Gui_GetTextOffset(TextBox->FontSize);
 
 	num_of_visible_lines = TextBox->Height / font_height;
 	num_of_char_per_line = TextBox->Width / font_width;
 	start_visible_char_index = TextBox->ScrollIndex * num_of_char_per_line;
 	end_visible_char_index = (num_of_visible_lines + TextBox->ScrollIndex) * num_of_char_per_line;
 
-	for(x_step = 0, i = start_visible_char_index;
+	//Text is drawn opaque inside the border, background is filled only where no character cell covers it
+	Graphics_PushClip(TextBox->XPos + 1, TextBox->YPos + 1, TextBox->Width - 2, TextBox->Height - 2);
+
+	for(i = start_visible_char_index;
 			(TextBox->String[i] != '\0') && (i < end_visible_char_index);
-			x_step += font_width, i++)
+			i += line_length)
 	{
-		//Draw only visible part of text
-		if( (i % num_of_char_per_line) == 0)
+		//Jump to beginning of new line
+		y_step += font_height;
+
+		line_length = 0;
+		while( (line_length < num_of_char_per_line) && (TextBox->String[i + line_length] != '\0') )
 		{
-			//Jum to beginning of new line
-			y_step += font_height;
-			x_step = 0;
+			line_length++;
 		}
 
-		Graphics_DrawChar(TextBox->XPos + x_step + 2,
+		Graphics_DrawString(TextBox->XPos + 2,
 							TextBox->YPos + TextBox->Height - font_gap - y_step,
-							TextBox->String[i],
+							&TextBox->String[i],
+							line_length,
 							TextBox->FontSize,
-							TextBox->FontColor);
+							TextBox->FontColor,
+							TextBox->BackgroundColor,
+							GRAPHICS_TEXT_OPAQUE);
+
+		//Background left and right of the line, top line may start above the TextBox
+		line_top = (TextBox->Height - font_gap > y_step) ? TextBox->YPos + TextBox->Height - font_gap - y_step + 1 : TextBox->YPos + 1;
+
+		Graphics_DrawRect(TextBox->XPos + 1,
+						line_top,
+						TextBox->XPos + 2,
+						TextBox->YPos + TextBox->Height - font_gap - y_step + font_height + 1,
+						TextBox->BackgroundColor);
+
+		Graphics_DrawRect(TextBox->XPos + 2 + line_length * font_width,
+						line_top,
+						TextBox->XPos + TextBox->Width - 1,
+						TextBox->YPos + TextBox->Height - font_gap - y_step + font_height + 1,
+						TextBox->BackgroundColor);
 	}
+
+	//Background above and below the lines
+	if(TextBox->Height - font_gap > y_step)
+	{
+		Graphics_DrawRect(TextBox->XPos + 1,
+						TextBox->YPos + 1,
+						TextBox->XPos + TextBox->Width - 1,
+						TextBox->YPos + TextBox->Height - font_gap - y_step + 1,
+						TextBox->BackgroundColor);
+	}
+
+	Graphics_DrawRect(TextBox->XPos + 1,
+					TextBox->YPos + TextBox->Height - font_gap + 1,
+					TextBox->XPos + TextBox->Width - 1,
+					TextBox->YPos + TextBox->Height - 1,
+					TextBox->BackgroundColor);
+
+	Graphics_PopClip();
+
+	Gui_EndDraw();
 }
 
 /**
@@ -826,25 +874,8 @@ void Gui_TextBoxAddToString(GUI_TEXTBOX_TYPE *TextBox, char *string)
 	}
 	TextBox->String[i] = '\0';
 
-	switch(TextBox->FontSize)
-	{
-	case FONT_8P:
-		font_width = FONT_8P_WIDTH;
-		font_height = FONT_8P_HEIGHT;
-		break;
-	case FONT_8P_BOLD:
-		font_width = FONT_8P_WIDTH;
-		font_height = FONT_8P_HEIGHT;
-		break;
-	case FONT_12P:
-		font_width = FONT_12P_WIDTH;
-		font_height = FONT_12P_HEIGHT;
-		break;
-	case FONT_16P:
-		font_width = FONT_16P_WIDTH;
-		font_height = FONT_16P_HEIGHT;
-		break;
-	}
+	font_width = Graphics_GetFontWidth(TextBox->FontSize);
+	font_height = Graphics_GetFontHeight(TextBox->FontSize);
 
 	num_of_visible_lines = TextBox->Height / font_height;
 	num_of_char_per_line = TextBox->Width / font_width;
@@ -880,21 +911,7 @@ void Gui_TextBoxSetString(GUI_TEXTBOX_TYPE *TextBox, char *string)
 	unsigned short source_index = 0;
 	unsigned short num_of_char_per_line = 0;
 
-	switch(TextBox->FontSize)
-	{
-	case FONT_8P:
-		font_width = FONT_8P_WIDTH;
-		break;
-	case FONT_8P_BOLD:
-		font_width = FONT_8P_WIDTH;
-		break;
-	case FONT_12P:
-		font_width = FONT_12P_WIDTH;
-		break;
-	case FONT_16P:
-		font_width = FONT_16P_WIDTH;
-		break;
-	}
+	font_width = Graphics_GetFontWidth(TextBox->FontSize);
 
 	//Copy string to buff
 	strcpy(buff, string);
@@ -963,26 +980,29 @@ void Gui_AddDataToGraph(GUI_GRAPH_TYPE *Graph, unsigned char data)
 void Gui_RefreshGraph(GUI_GRAPH_TYPE *Graph)
 {
 	unsigned short i = 0;
-	static unsigned int RefreshCnt = 0;
-	static unsigned char PreviousData[GUI_NUM_OF_GRAPH_DATA];
+
+	Gui_BeginDraw("Gui_RefreshGraph", CALLER_GRAPH);
 	// Draw plot
 
-	if(RefreshCnt++ >= GUI_GRAPH_REFRESH_RATE)
+	if(Graph->RefreshCnt++ >= GUI_GRAPH_REFRESH_RATE)
 	{
-		RefreshCnt = 0;
+		Graph->RefreshCnt = 0;
 		for(i = 0; Graph != NULL, i < GUI_NUM_OF_GRAPH_DATA; i++)
 		{
 			GraphicDriver_DrawPoint(Graph->XPos + i,
-											Graph->YPos + PreviousData[i],
+											Graph->YPos + Graph->PlotData[i],
 											Gui_RGB888To565(0xCC, 0xCC, 0xCC));
 
 			GraphicDriver_DrawPoint(Graph->XPos + i,
 									Graph->YPos + Graph->GraphData[i],
 									0xF800);
 
-			PreviousData[i] = Graph->GraphData[i];
+			Graph->PlotData[i] = Graph->GraphData[i];
 		}
+		Graph->IsPlotted = TRUE;
 	}
+
+	Gui_EndDraw();
 }
 
 /**
@@ -1353,9 +1373,32 @@ void Gui_DeleteTextBox(GUI_VIEW_TYPE *View)
 /**
  * @brief Draw View containing lists of define GUI components
  *
+ * @details View is drawn on its display, which stays selected only meanwhile. In banded frame buffer
+ * mode the View is drawn once per band. It is one frame of GraphicDriver statistics.
+ *
  * @param View - pointer to GUI_VIEW_TYPE type element
  */
 void Gui_DrawView(GUI_VIEW_TYPE *View)
+{
+	GRAPHIC_DRIVER_DISPLAY_TYPE *previous = Gui_SelectDisplay(View);
+
+	Gui_BeginDraw("Gui_DrawView", CALLER_OTHER);
+
+	Gui_RenderBands(View, 0, GraphicDriver_GetHeight());
+
+	View->IsCreated = TRUE;
+
+	Gui_EndDraw();
+	GraphicDriver_EndFrame();
+	GraphicDriver_SelectDisplay(previous);
+}
+
+/**
+ * @brief Draw all elements of View
+ *
+ * @param View - pointer to GUI_VIEW_TYPE type element
+ */
+void Gui_DrawViewElements(GUI_VIEW_TYPE *View)
 {
 	GUI_LABEL_LIST_TYPE *LabelListBuffer = NULL;
 	GUI_BUTTON_LIST_TYPE *ButtonListBuffer = NULL;
@@ -1379,7 +1422,14 @@ void Gui_DrawView(GUI_VIEW_TYPE *View)
 	//Draw every button in the list
 	for(ButtonListBuffer = View->ButtonList; ButtonListBuffer != NULL; ButtonListBuffer = ButtonListBuffer->Next)
 	{
-		Gui_DrawButton( &(ButtonListBuffer->ButtonElement) );
+		if(ButtonListBuffer->ButtonElement.Id == SelectedButtonId)
+		{
+			Gui_DrawSelectedButton( &(ButtonListBuffer->ButtonElement) );
+		}
+		else
+		{
+			Gui_DrawButton( &(ButtonListBuffer->ButtonElement) );
+		}
 	}
 
 	//Draw every slider in the list
@@ -1409,8 +1459,38 @@ void Gui_DrawView(GUI_VIEW_TYPE *View)
 	{
 		Gui_DrawTextBox(View->TextBox);
 	}
+}
 
-	View->IsCreated = TRUE;
+/**
+ * @brief Draw View elements covering screen rows y_start..y_end - 1 and flush them to LCD
+ *
+ * @details With frame buffer holding the whole screen, or without frame buffer, it is a single pass.
+ * In banded mode every band covering the rows is cleared, all View elements are drawn clipped to it
+ * and the band is flushed. With two frame buffers and asynchronous LCD port the next band is drawn
+ * while the previous one is transferred. Afterwards band is parked below the screen, so drawing made outside
+ * of this function only records damaged rows, which Gui_Task renders again.
+ *
+ * @param View - pointer to GUI_VIEW_TYPE type element
+ */
+void Gui_RenderBands(GUI_VIEW_TYPE *View, unsigned short y_start, unsigned short y_end)
+{
+	unsigned short band_height = GraphicDriver_GetBandHeight();
+	unsigned short band_y = 0;
+
+	for(band_y = y_start - (y_start % band_height); band_y < y_end; band_y += band_height)
+	{
+		GraphicDriver_SetBand(band_y);
+		Gui_DrawViewElements(View);
+		GraphicDriver_FlushAsync(NULL);
+	}
+
+	if(band_height < GraphicDriver_GetHeight())
+	{
+		GraphicDriver_SetBand(GraphicDriver_GetHeight());
+
+		//Discard rows damaged by rendering itself
+		GraphicDriver_GetDamagedRows(&y_start, &y_end);
+	}
 }
 
 /**
@@ -1436,7 +1516,11 @@ void Gui_DeleteView(GUI_VIEW_TYPE *View)
 /**
  *	@brief Periodic Gui task
  *
- *	@details Periodic task that scans touch sensing data about GUI components and refreshes the Graph
+ *	@details Periodic task that scans touch sensing data about GUI components and refreshes the Graph.
+ *	View is serviced on its display, touch is scanned only when it is the display touchscreen is laid on.
+ *	At the end of the task frame buffer, if enabled, is flushed to LCD. In banded frame buffer mode rows
+ *	redrawn by the task are rendered again from the View band by band. Every task run is one frame of
+ *	GraphicDriver statistics.
  *
  *	@param View - pointer to GUI_VIEW_TYPE type element
  *
@@ -1444,15 +1528,219 @@ void Gui_DeleteView(GUI_VIEW_TYPE *View)
  */
 void Gui_Task(GUI_VIEW_TYPE *View)
 {
-	Gui_ScanButtons(View->ButtonList);
-	Gui_ScanSlider(View->SliderList);
-	Gui_ScanCheckbox(View->CheckboxList);
-	Gui_ScanTextBox(View->TextBox);
+	unsigned short y_start = 0, y_end = 0;
+	GRAPHIC_DRIVER_DISPLAY_TYPE *previous = Gui_SelectDisplay(View);
+
+	Gui_BeginDraw("Gui_Task", CALLER_OTHER);
+
+	if(GraphicDriver_GetDisplay() == TouchDriver_GetDisplay())
+	{
+		Gui_ScanButtons(View->ButtonList);
+		Gui_ScanSlider(View->SliderList);
+		Gui_ScanCheckbox(View->CheckboxList);
+		Gui_ScanTextBox(View->TextBox);
+	}
 
 	if(View->Graph != NULL)
 	{
 		Gui_RefreshGraph(View->Graph);
 	}
+
+	if(GraphicDriver_GetBandHeight() < GraphicDriver_GetHeight())
+	{
+		//Band holds no rows here, redraws above only recorded damaged rows. Render them again from the View.
+		if(GraphicDriver_GetDamagedRows(&y_start, &y_end) == TRUE)
+		{
+			Gui_RenderBands(View, y_start, y_end);
+		}
+	}
+	else
+	{
+		//Transfer everything redrawn in this tick to LCD at once, in background when LCD port supports it
+		GraphicDriver_FlushAsync(NULL);
+	}
+
+	Gui_EndDraw();
+	GraphicDriver_EndFrame();
+	GraphicDriver_SelectDisplay(previous);
+}
+
+/**
+ *	@brief Periodic Gui task of several Views, e.g. one per display
+ *
+ *	@details Views on the display touchscreen is laid on are serviced with Gui_Task on every call, so touch
+ *	handling never waits for other displays. Other Views take turns, round-robin, while GUI_TASK_BUDGET
+ *	ticks of Gui_SetClock clock are left since the call started. Without clock one of them is serviced per call.
+ *
+ *	@param Views - array of pointers to GUI_VIEW_TYPE type elements
+ *	@param Count - number of Views in the array
+ */
+void Gui_TaskViews(GUI_VIEW_TYPE *Views[], unsigned char Count)
+{
+	unsigned long start = (Clock != NULL) ? Clock() : 0;
+	unsigned char i, index;
+	bool is_serviced = FALSE;
+
+	for(i = 0; i < Count; i++)
+	{
+		if(Gui_IsTouchView(Views[i]) == TRUE)
+		{
+			Gui_Task(Views[i]);
+		}
+	}
+
+	for(i = 0; i < Count; i++)
+	{
+		index = (NextView + i) % Count;
+		if(Gui_IsTouchView(Views[index]) == TRUE)
+		{
+			continue;
+		}
+
+		if( (Clock == NULL) ? (is_serviced == TRUE) : (Clock() - start >= GUI_TASK_BUDGET) )
+		{
+			break;
+		}
+
+		Gui_Task(Views[index]);
+		is_serviced = TRUE;
+		NextView = index + 1;
+	}
+}
+
+/**
+ * @brief Set clock Gui_TaskViews measures its time budget with
+ *
+ * @param clock - pointer to GUI_CLOCK_TYPE function, NULL to service one View off touchscreen display per call
+ */
+void Gui_SetClock(GUI_CLOCK_TYPE clock)
+{
+	Clock = clock;
+}
+
+/**
+ * @brief Set hook called on entry and exit of every drawing function, e.g. to profile them
+ *
+ * @details Hook is called with function name, the same pointer on every call, on entry of
+ * Gui_Draw functions, Gui_Task and Graph refresh, and with NULL on their exit. Calls nest.
+ * On host LcdHost_Section breaks host LCD bus traffic down by drawing function.
+ *
+ * @param hook - pointer to GUI_DRAW_HOOK_TYPE function, NULL to remove
+ */
+void Gui_SetDrawHook(GUI_DRAW_HOOK_TYPE hook)
+{
+	DrawHook = hook;
+}
+
+/**
+ * @brief Report entry of drawing function to draw hook, if set, and to GraphicDriver statistics
+ *
+ * @param name - drawing function name
+ * @param caller - GUI component drawn, drawing is counted for the outermost one
+ */
+void Gui_BeginDraw(const char *name, GRAPHIC_DRIVER_CALLER_TYPE caller)
+{
+	GraphicDriver_BeginCaller(caller);
+	if(DrawHook != NULL)
+	{
+		DrawHook(name);
+	}
+}
+
+/**
+ * @brief Report exit of drawing function entered with Gui_BeginDraw
+ */
+void Gui_EndDraw(void)
+{
+	if(DrawHook != NULL)
+	{
+		DrawHook(NULL);
+	}
+	GraphicDriver_EndCaller();
+}
+
+/**
+ * @brief Select display of View in GraphicDriver module
+ *
+ * @return display selected before, so it can be selected back
+ */
+GRAPHIC_DRIVER_DISPLAY_TYPE* Gui_SelectDisplay(GUI_VIEW_TYPE *View)
+{
+	if(View->Display == NULL)
+	{
+		return GraphicDriver_GetDisplay();
+	}
+	return GraphicDriver_SelectDisplay(View->Display);
+}
+
+/**
+ * @brief Check if View is shown on the display touchscreen is laid on
+ */
+bool Gui_IsTouchView(GUI_VIEW_TYPE *View)
+{
+	return ( ((View->Display != NULL) ? View->Display : GraphicDriver_GetDisplay()) == TouchDriver_GetDisplay() ) ? TRUE : FALSE;
+}
+
+/**
+ * @brief Get number of rows text of a font is drawn above y coordinate of Gui element
+ */
+unsigned char Gui_GetTextOffset(FONT_SIZE_TYPE font)
+{
+	if(font == FONT_16P)
+	{
+		return 4;
+	}
+	else if( (font == FONT_12P) || (font == FONT_8P_BOLD) )
+	{
+		return 2;
+	}
+
+	return 0;
+}
+
+/**
+ * @brief Draw text run on background rectangle, each pixel of the rectangle is written once
+ *
+ * @details Text is drawn opaque and clipped to the rectangle, background is filled above, below, left and right
+ * of it only.
+ *
+ * @param x_start, y_start - top left corner of background rectangle
+ * @param x_end, y_end - corner right of and below background rectangle
+ * @param x, y - text position like in Graphics_DrawString, may be left of or above the screen
+ */
+void Gui_DrawTextOnBackground(unsigned short x_start,
+							unsigned short y_start,
+							unsigned short x_end,
+							unsigned short y_end,
+							int x,
+							int y,
+							char *string,
+							unsigned short length,
+							FONT_SIZE_TYPE font,
+							unsigned int color,
+							unsigned int background)
+{
+	int text_x_start, text_y_start, text_x_end, text_y_end;
+
+	if( (x_end <= x_start) || (y_end <= y_start) )
+	{
+		return;
+	}
+
+	//Text run covers rows y + 1 to y + font height, limited to background rectangle
+	text_x_start = MIN( MAX(x, (int)x_start), (int)x_end );
+	text_y_start = MIN( MAX(y + 1, (int)y_start), (int)y_end );
+	text_x_end = MIN( MAX(x + Graphics_GetFontWidth(font) * length, text_x_start), (int)x_end );
+	text_y_end = MIN( MAX(y + 1 + Graphics_GetFontHeight(font), text_y_start), (int)y_end );
+
+	Graphics_PushClip(x_start, y_start, x_end - x_start, y_end - y_start);
+	Graphics_DrawString(x, y, string, length, font, color, background, GRAPHICS_TEXT_OPAQUE);
+	Graphics_PopClip();
+
+	Graphics_DrawRect(x_start, y_start, x_end, text_y_start, background);
+	Graphics_DrawRect(x_start, text_y_start, text_x_start, text_y_end, background);
+	Graphics_DrawRect(text_x_end, text_y_start, x_end, text_y_end, background);
+	Graphics_DrawRect(x_start, text_y_end, x_end, y_end, background);
 }
 
 /**
@@ -1467,7 +1755,6 @@ void Gui_ScanButtons(GUI_BUTTON_LIST_TYPE *ButtonList)
 {
 	static TOUCH_EVENT_TYPE GuiButtonTouchEvent = EVENT_TOUCH_IDLE;
 	GUI_BUTTON_LIST_TYPE *ButtonListBuffer = NULL;
-	static unsigned char SlectedButtonId = 0;
 	ButtonListBuffer = ButtonList;
 
 	switch(GuiButtonTouchEvent)
@@ -1483,7 +1770,7 @@ void Gui_ScanButtons(GUI_BUTTON_LIST_TYPE *ButtonList)
 						(TouchDriver_GetY() >= ButtonListBuffer->ButtonElement.YPos) &&
 						(TouchDriver_GetY() < (ButtonListBuffer->ButtonElement.YPos + ButtonListBuffer->ButtonElement.Height) ) )
 					{
-						SlectedButtonId = ButtonListBuffer->ButtonElement.Id;
+						SelectedButtonId = ButtonListBuffer->ButtonElement.Id;
 						Gui_DrawSelectedButton( &(ButtonListBuffer->ButtonElement) );
 						// TODO add on click event
 						// ......
@@ -1493,13 +1780,13 @@ void Gui_ScanButtons(GUI_BUTTON_LIST_TYPE *ButtonList)
 					}
 					else
 					{
-						SlectedButtonId = 0;
+						SelectedButtonId = 0;
 					}
 				}
 			}
 			else
 			{
-				SlectedButtonId = 0;
+				SelectedButtonId = 0;
 			}
 			break;
 
@@ -1512,12 +1799,12 @@ void Gui_ScanButtons(GUI_BUTTON_LIST_TYPE *ButtonList)
 			break;
 
 		case EVENT_TOUCH_RELEASE:
-			for(; (ButtonListBuffer != NULL) && (ButtonListBuffer->ButtonElement.Id != SlectedButtonId); ButtonListBuffer = ButtonListBuffer->Next)
+			for(; (ButtonListBuffer != NULL) && (ButtonListBuffer->ButtonElement.Id != SelectedButtonId); ButtonListBuffer = ButtonListBuffer->Next)
 			{
 				//empty loop, wait for condition (SliderListBuffer->SliderElement.Id == SlectedSliderId)
 			}
 
-			SlectedButtonId = 0;
+			SelectedButtonId = 0;
 			Gui_DrawButton( &(ButtonListBuffer->ButtonElement) );
 
 			if(ButtonListBuffer->ButtonElement.OnReleaseEvent != NULL)
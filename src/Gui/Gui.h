@@ -28,9 +28,21 @@
 //! Graph refresh rate
 #define GUI_GRAPH_REFRESH_RATE		(24/25)		// 25 ms refresh rate
 
+//! Time budget of Gui_TaskViews in Gui_SetClock ticks. Views not on touchscreen display are serviced
+//! while time is left after those on it.
+#ifndef GUI_TASK_BUDGET
+#define GUI_TASK_BUDGET				10
+#endif
+
 //! Declaration of Event type
 typedef void (* GUI_EVENT_TYPE)(void);
 
+//! Draw hook type, called with function name on entry of every Gui drawing function and with NULL on its exit
+typedef void (* GUI_DRAW_HOOK_TYPE)(const char *name);
+
+//! Clock type, returns free running tick count, e.g. milliseconds
+typedef unsigned long (* GUI_CLOCK_TYPE)(void);
+
 //! Text Alignment type, right, left or center
 typedef enum
 {
@@ -235,6 +247,9 @@ typedef struct
 	unsigned short YPos;
 	unsigned char Scale;		//0 - 100 %
 	unsigned char GraphData[GUI_NUM_OF_GRAPH_DATA];
+	unsigned char PlotData[GUI_NUM_OF_GRAPH_DATA];	//Data points currently plotted on the screen
+	bool IsPlotted;				//PlotData holds plotted points, set after first refresh
+	unsigned int RefreshCnt;
 } GUI_GRAPH_TYPE;
 
 //! Graph type default values
@@ -252,10 +267,11 @@ typedef struct
 	GUI_SLIDER_LIST_TYPE *SliderList;
 	GUI_CHECKBOX_LIST_TYPE *CheckboxList;
 	GUI_LED_LIST_TYPE *LedList;
+	GRAPHIC_DRIVER_DISPLAY_TYPE *Display;	//Display the View is shown on, NULL for display selected in GraphicDriver
 } GUI_VIEW_TYPE;
 
 //! View type default values
-#define VIEW_DEFAULT	(GUI_VIEW_TYPE){FALSE, NULL, NULL, NULL, NULL, NULL, NULL, NULL, NULL}
+#define VIEW_DEFAULT	(GUI_VIEW_TYPE){FALSE, NULL, NULL, NULL, NULL, NULL, NULL, NULL, NULL, NULL}
 
 GUI_BUTTON_TYPE* 	Gui_NewButton(GUI_VIEW_TYPE *View);
 GUI_LABEL_TYPE* 	Gui_NewLabel(GUI_VIEW_TYPE *View);
@@ -286,6 +302,9 @@ void				Gui_TextBoxAddToString(GUI_TEXTBOX_TYPE *TextBox, char *string);
 char*				Gui_TextBoxGetStringPointer(void);
 
 void 				Gui_Task(GUI_VIEW_TYPE *View);
+void				Gui_TaskViews(GUI_VIEW_TYPE *Views[], unsigned char Count);
+void				Gui_SetClock(GUI_CLOCK_TYPE clock);
+void				Gui_SetDrawHook(GUI_DRAW_HOOK_TYPE hook);
 
 char*				Gui_IntToString(char *string, int num);
 unsigned int 		Gui_RGB888To565(unsigned char red, unsigned char green, unsigned char blue);
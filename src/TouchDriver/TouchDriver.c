@@ -15,6 +15,7 @@
  */
 
 #include "TouchDriver.h"
+#include <stddef.h>
 
 #define TOUCH_ALPHA_BITS		2
 #define TOUCH_FILTER_DEBOUNCE	40		//40 [ms]
@@ -49,6 +50,13 @@ static volatile unsigned short FilteredYData;		//!< Holds filtered Y coordinate
 static volatile unsigned short IirXData;			//!< temporary filter data for X coordinate
 static volatile unsigned short IirYData;			//!< temporary filter data for Y coordinate
 static volatile unsigned short Touch1msCnt;			//!< Counter that is used to debounce touch event
+static GRAPHIC_DRIVER_DISPLAY_TYPE *Display;		//!< Display the touchscreen is laid on, NULL for display selected in GraphicDriver module
+#if (TOUCH_DRIVER_HOST != 0)
+static bool HostIsTouched;							//!< Host touch is held down
+static bool HostIsReadingX;							//!< ADC is configured to read X position
+static unsigned short HostX;						//!< Panel X coordinate of host touch
+static unsigned short HostY;						//!< Panel Y coordinate of host touch
+#endif
 
 unsigned short TouchDriver_CalculateXCord(unsigned short filtered_x);
 unsigned short TouchDriver_CalculateYCord(unsigned short filtered_y);
@@ -58,10 +66,14 @@ void TouchDriver_ConfigureToDetectTouch(void);
 unsigned short TouchDriver_IIRFilter(volatile unsigned short *iir_value, volatile unsigned short new_value, unsigned char alpha_bits);
 bool TouchDriver_DetectTouch(void);
 unsigned short TouchDriver_GetAdcTouchData(void);
+void TouchDriver_PanelToScreen(unsigned short panel_x, unsigned short panel_y, unsigned short *x, unsigned short *y);
 
 /**
  * @brief Initialize MCU to read analog touch screen data
  *
+ * @details Touchscreen is taken to be laid on the display selected in GraphicDriver module, unless
+ * TouchDriver_SetDisplay says otherwise
+ *
  * @note This function should be implemented according to proper MCU procedure
  */
 void TouchDriver_Initialize(void)
@@ -90,6 +102,24 @@ void TouchDriver_Initialize(void)
     IirYData = 0;
     TouchData.State = TOUCH_WAITING_FOR_TOUCH;
     TouchData.IsTouchDetected = FALSE;
+    Display = GraphicDriver_GetDisplay();
+}
+
+/**
+ * @brief Set display the touchscreen is laid on, its panel size and rotation map touch coordinates
+ */
+void TouchDriver_SetDisplay(GRAPHIC_DRIVER_DISPLAY_TYPE *display)
+{
+	Display = display;
+}
+
+/**
+ * @brief Get display the touchscreen is laid on
+ */
+GRAPHIC_DRIVER_DISPLAY_TYPE* TouchDriver_GetDisplay(void)
+{
+	//Not set before TouchDriver_Initialize
+	return (Display != NULL) ? Display : GraphicDriver_GetDisplay();
 }
 
 /**
@@ -181,44 +211,80 @@ bool TouchDriver_IsTouchDetected(void)
 }
 
 /**
- * @brief Get filtered X coordinate
+ * @brief Get filtered X coordinate, in screen coordinates of touchscreen display
  *
- * @return TouchData.Xpos - unsigned short
+ * @return X coordinate - unsigned short
  */
 unsigned short TouchDriver_GetX(void)
 {
-	return TouchData.Xpos;
+	unsigned short x, y;
+
+	TouchDriver_PanelToScreen(TouchData.Xpos, TouchData.Ypos, &x, &y);
+	return x;
 }
 
 /**
- * @brief Get filtered Y coordinate
+ * @brief Get filtered Y coordinate, in screen coordinates of touchscreen display
  *
- * @return TouchData.Ypos - unsigned short
+ * @return Y coordinate - unsigned short
  */
 unsigned short TouchDriver_GetY(void)
 {
-	return TouchData.Ypos;
+	unsigned short x, y;
+
+	TouchDriver_PanelToScreen(TouchData.Xpos, TouchData.Ypos, &x, &y);
+	return y;
 }
 
 /**
- * @brief Get non filtered X coordinate
+ * @brief Get non filtered X coordinate, in screen coordinates of touchscreen display
  *
  * @return X coordinate - unsigned short
  */
 unsigned short TouchDriver_GetRawX(void)
 {
-	return TouchDriver_CalculateXCord(RawXData);
+	unsigned short x, y;
+
+	TouchDriver_PanelToScreen(TouchDriver_CalculateXCord(RawXData), TouchDriver_CalculateYCord(RawYData), &x, &y);
+	return x;
 }
 
 /**
- * @brief Get non filtered Y coordinate
+ * @brief Get non filtered Y coordinate, in screen coordinates of touchscreen display
  *
  * @return Y coordinate - unsigned short
  */
 unsigned short TouchDriver_GetRawY(void)
 {
-	return TouchDriver_CalculateYCord(RawYData);
+	unsigned short x, y;
+
+	TouchDriver_PanelToScreen(TouchDriver_CalculateXCord(RawXData), TouchDriver_CalculateYCord(RawYData), &x, &y);
+	return y;
+}
+
+#if (TOUCH_DRIVER_HOST != 0)
+/**
+ * @brief Press touchscreen on host, until TouchDriver_HostRelease
+ *
+ * @details Touch is reported by TouchDriver_Task after debouncing, like on target
+ *
+ * @param x, y - panel coordinates, rotation not included
+ */
+void TouchDriver_HostTouch(unsigned short x, unsigned short y)
+{
+	HostX = x;
+	HostY = y;
+	HostIsTouched = TRUE;
+}
+
+/**
+ * @brief Release touchscreen pressed with TouchDriver_HostTouch
+ */
+void TouchDriver_HostRelease(void)
+{
+	HostIsTouched = FALSE;
 }
+#endif
 
 /**
  * @brief Detect touch event by hardware
@@ -231,7 +297,12 @@ bool TouchDriver_DetectTouch(void)
 {
 	//TODO read GPIO pin for touch detection, example on STM32 Cortex-M3
 //	return (bool) GPIO_ReadInputDataBit(GPIOC, YU);
+#if (TOUCH_DRIVER_HOST != 0)
+	//Pulled up YU pin reads low while touched
+	return (HostIsTouched == TRUE) ? FALSE : TRUE;
+#else
 	return FALSE;
+#endif
 }
 
 /**
@@ -246,7 +317,21 @@ unsigned short TouchDriver_GetAdcTouchData(void)
 
 	//TODO read analog voltage value from ADC, example on STM32 Cortex-M3
 //	return ADC_GetConversionValue(ADC1);
+#if (TOUCH_DRIVER_HOST != 0)
+	unsigned int width = TouchDriver_GetDisplay()->Panel.Width;
+	unsigned int height = TouchDriver_GetDisplay()->Panel.Height;
+
+	//Inverse of TouchDriver_CalculateXCord and TouchDriver_CalculateYCord, rounded up so they give back the same coordinate
+	if(HostIsReadingX == TRUE)
+	{
+		return (unsigned short)(TOUCH_X_LOWEST_VALID_VALUE
+				+ ((width - HostX) * (TOUCH_X_HIGHEST_VALID_VALUE - TOUCH_X_LOWEST_VALID_VALUE) + width - 1) / width);
+	}
+	return (unsigned short)(TOUCH_Y_LOWEST_VALID_VALUE
+			+ (HostY * (TOUCH_Y_HIGHEST_VALID_VALUE - TOUCH_Y_LOWEST_VALID_VALUE) + height - 1) / height);
+#else
 	return 0;
+#endif
 }
 
 /**
@@ -257,6 +342,9 @@ unsigned short TouchDriver_GetAdcTouchData(void)
  */
 void TouchDriver_ConfigureToReadX(void)
 {
+#if (TOUCH_DRIVER_HOST != 0)
+	HostIsReadingX = TRUE;
+#endif
 	/*
 	//Disable ADC
     ADC_Cmd(ADC1, DISABLE);
@@ -301,6 +389,9 @@ void TouchDriver_ConfigureToReadX(void)
  */
 void TouchDriver_ConfigureToReadY(void)
 {
+#if (TOUCH_DRIVER_HOST != 0)
+	HostIsReadingX = FALSE;
+#endif
 	/*
 	//Disable ADC
     ADC_Cmd(ADC1, DISABLE);
@@ -412,12 +503,25 @@ unsigned short TouchDriver_IIRFilter(volatile unsigned short *iir_value, volatil
 }
 
 /**
- * @brief Calculate X coordinate from filtered value
+ * @brief Transform panel coordinates into screen coordinates of touchscreen display, whichever display is selected
+ */
+void TouchDriver_PanelToScreen(unsigned short panel_x, unsigned short panel_y, unsigned short *x, unsigned short *y)
+{
+	GRAPHIC_DRIVER_DISPLAY_TYPE *previous = GraphicDriver_SelectDisplay(TouchDriver_GetDisplay());
+
+	GraphicDriver_PanelToScreen(panel_x, panel_y, x, y);
+	GraphicDriver_SelectDisplay(previous);
+}
+
+/**
+ * @brief Calculate panel X coordinate from filtered value
  *
  * @details filtered x value need to be biased, linearized and limited
  */
 unsigned short TouchDriver_CalculateXCord(unsigned short filtered_x)
 {
+	unsigned int width = TouchDriver_GetDisplay()->Panel.Width;
+
 	if(filtered_x <= TOUCH_X_LOWEST_VALID_VALUE)
 	{
 		filtered_x = TOUCH_X_LOWEST_VALID_VALUE;
@@ -428,16 +532,18 @@ unsigned short TouchDriver_CalculateXCord(unsigned short filtered_x)
 	}
 	filtered_x -= TOUCH_X_LOWEST_VALID_VALUE;
 
-	return (unsigned short)(H_RES - (unsigned int)(H_RES * filtered_x)/(TOUCH_X_HIGHEST_VALID_VALUE - TOUCH_X_LOWEST_VALID_VALUE) );
+	return (unsigned short)(width - (width * filtered_x)/(TOUCH_X_HIGHEST_VALID_VALUE - TOUCH_X_LOWEST_VALID_VALUE) );
 }
 
 /**
- * @brief Calculate Y coordinate from filtered value
+ * @brief Calculate panel Y coordinate from filtered value
  *
  * @details filtered y value need to be biased, linearized and limited
  */
 unsigned short TouchDriver_CalculateYCord(unsigned short filtered_y)
 {
+	unsigned int height = TouchDriver_GetDisplay()->Panel.Height;
+
 	if(filtered_y <= TOUCH_Y_LOWEST_VALID_VALUE)
 	{
 		filtered_y = TOUCH_Y_LOWEST_VALID_VALUE;
@@ -448,5 +554,5 @@ unsigned short TouchDriver_CalculateYCord(unsigned short filtered_y)
 	}
 	filtered_y -= TOUCH_Y_LOWEST_VALID_VALUE;
 
-	return (unsigned short)( (unsigned int)(V_RES * filtered_y)/(TOUCH_Y_HIGHEST_VALID_VALUE - TOUCH_Y_LOWEST_VALID_VALUE) );
+	return (unsigned short)( (height * filtered_y)/(TOUCH_Y_HIGHEST_VALID_VALUE - TOUCH_Y_LOWEST_VALID_VALUE) );
 }
@@ -18,6 +18,12 @@
 #include "../Typedefs.h"
 #include "../GraphicDriver/GraphicDriver.h"
 
+//! Set to 1 to replace touchscreen hardware access with touches given by TouchDriver_HostTouch, e.g. for
+//! host tests. Touch runs through the same state machine, filter and calibration as on target.
+#ifndef TOUCH_DRIVER_HOST
+#define TOUCH_DRIVER_HOST	0
+#endif
+
 //! Enumerated states of TouchDriver state machine
 typedef enum
 {
@@ -37,10 +43,16 @@ typedef struct
 
 void TouchDriver_Initialize(void);
 void TouchDriver_Task(void);
+void TouchDriver_SetDisplay(GRAPHIC_DRIVER_DISPLAY_TYPE *display);
+GRAPHIC_DRIVER_DISPLAY_TYPE* TouchDriver_GetDisplay(void);
 bool TouchDriver_IsTouchDetected(void);
 unsigned short TouchDriver_GetRawY(void);
 unsigned short TouchDriver_GetRawX(void);
 unsigned short TouchDriver_GetX(void);
 unsigned short TouchDriver_GetY(void);
+#if (TOUCH_DRIVER_HOST != 0)
+void TouchDriver_HostTouch(unsigned short x, unsigned short y);
+void TouchDriver_HostRelease(void);
+#endif
 
 #endif /* TOUCHDRIVER_H_ */
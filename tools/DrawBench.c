@@ -0,0 +1,346 @@
+/**
+ * @file DrawBench.c
+ *
+ * @brief Host benchmark of line and text drawing, on LcdHost driver.
+ *
+ * @details Draws line and text workloads straight to LcdHost and reports for each of them LcdHost bus
+ * counters, time and pixels per second. Line workload is a fan of sloped lines from screen center to its
+ * border, drawn with Graphics_DrawLine and, for comparison, with the division based rasterizer it replaced,
+ * which computes (i * y_width) / x_width for every pixel and draws it with GraphicDriver_DrawPoint.
+ * Text workload fills the screen with rows of characters of every font, transparent and opaque.
+ * Line workload is run again on a driver dropping every pixel, to time the rasterizers without bus time.
+ * Every workload is run DRAW_BENCH_REPEATS times and the shortest time is reported.
+ * Built and run on the host from repository root:
+ *
+ * gcc -std=gnu99 -O2 -Isrc tools/DrawBench.c src/Fonts.c src/GraphicDriver/FrameBuffer.c
+ * src/GraphicDriver/GraphicDriver.c src/GraphicDriver/LcdHost.c src/GraphicDriver/PixelFormat.c
+ * src/GraphicDriver/ShadowBuffer.c src/Graphics/Graphics.c -o DrawBench
+ * ./DrawBench
+ *
+ * Number of rounds of every workload may be given as the only argument.
+ *
+ * @author Krzysztof Grzeszczak
+ *
+ * @version 1.0
+ *
+ * @date 2012-2013
+ *
+ * @copyright GNU Public License
+ */
+
+#include "Graphics/Graphics.h"
+#include "GraphicDriver/LcdHost.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+
+//! Rounds of every workload when none are given
+#define DRAW_BENCH_ROUNDS		100
+
+//! Runs of every workload, the shortest one is reported
+#define DRAW_BENCH_REPEATS		5
+
+//! Distance in pixels between line ends on screen border
+#define DRAW_BENCH_LINE_STEP	4
+
+//! Line drawing function of line workload
+typedef void (* DRAW_BENCH_LINE_TYPE)(unsigned short x_start,
+									unsigned short y_start,
+									unsigned short x_end,
+									unsigned short y_end,
+									unsigned int color);
+
+static void DrawBench_Run(const char *name, DRAW_BENCH_LINE_TYPE draw_line, unsigned char flags, unsigned long rounds);
+static unsigned long DrawBench_Lines(DRAW_BENCH_LINE_TYPE draw_line, unsigned long rounds);
+static unsigned long DrawBench_Text(unsigned char flags, unsigned long rounds);
+static void DrawBench_DrawLineDivision(unsigned short x_start,
+									unsigned short y_start,
+									unsigned short x_end,
+									unsigned short y_end,
+									unsigned int color);
+static void DrawBench_SinkPoint(unsigned short x, unsigned short y, unsigned int color);
+static void DrawBench_SinkRect(unsigned short x, unsigned short y, unsigned short width, unsigned short height, unsigned int color);
+static double DrawBench_GetTime(void);
+
+//! Driver dropping every pixel, only counting them, so rasterizer time is measured without bus time
+static const GRAPHIC_DRIVER_TYPE DrawBench_SinkDriver =
+{
+	NULL,						//Initialize
+	DrawBench_SinkPoint,
+	NULL,						//GetPoint
+	NULL,						//ReadSpan
+	NULL,						//GetRow
+	DrawBench_SinkRect,
+	NULL,						//WriteSpan
+	NULL,						//DrawMask
+	NULL,						//SetWindow
+	NULL,						//WritePixels
+	NULL,						//WriteColor
+	NULL,						//EndWindow
+	NULL,						//WritePixelsAsync
+	NULL,						//Idle
+	NULL,						//Flush
+	NULL,						//FlushAsync
+	NULL,						//SetBand
+	NULL,						//GetDamagedRows
+	NULL,						//GetBandHeight
+	NULL,						//SetRotation
+	LCD_HOST_WIDTH,
+	LCD_HOST_HEIGHT,
+	PIXEL_FORMAT_RGB565
+};
+
+static volatile unsigned long DrawBench_SinkPixels;		//!< Pixels dropped by sink driver
+
+//! Text of text workload
+static const char DrawBench_String[] = "The quick brown fox jumps over the lazy dog 0123456789 !?";
+
+/**
+ * @brief Run every workload for defined number of rounds and print a row of counters for each
+ *
+ * @return 0 on success, 1 on bad argument
+ */
+int main(int argc, char *argv[])
+{
+	unsigned long rounds = DRAW_BENCH_ROUNDS;
+
+	if(argc > 2)
+	{
+		fprintf(stderr, "usage: %s [rounds]\n", argv[0]);
+		return 1;
+	}
+	if(argc == 2)
+	{
+		rounds = strtoul(argv[1], NULL, 10);
+		if(rounds == 0)
+		{
+			fprintf(stderr, "%s: expected number of rounds\n", argv[1]);
+			return 1;
+		}
+	}
+
+	GraphicDriver_Initialize(&LcdHost_Driver);
+
+	printf("workload            calls     pixels   points  windows      bytes    time ms  Mpixels/s\n");
+	DrawBench_Run("line, division", DrawBench_DrawLineDivision, GRAPHICS_TEXT_TRANSPARENT, rounds);
+	DrawBench_Run("line, Bresenham", Graphics_DrawLine, GRAPHICS_TEXT_TRANSPARENT, rounds);
+	DrawBench_Run("text, transparent", NULL, GRAPHICS_TEXT_TRANSPARENT, rounds);
+	DrawBench_Run("text, opaque", NULL, GRAPHICS_TEXT_OPAQUE, rounds);
+
+	GraphicDriver_Initialize(&DrawBench_SinkDriver);
+
+	printf("\nsink driver         calls     pixels                                  time ms  Mpixels/s\n");
+	DrawBench_Run("line, division", DrawBench_DrawLineDivision, GRAPHICS_TEXT_TRANSPARENT, rounds);
+	DrawBench_Run("line, Bresenham", Graphics_DrawLine, GRAPHICS_TEXT_TRANSPARENT, rounds);
+
+	return 0;
+}
+
+/**
+ * @brief Run workload DRAW_BENCH_REPEATS times and print its counters with the shortest time
+ *
+ * @details Pixels come from LcdHost counters, or from sink driver when it is the driver in use.
+ *
+ * @param name - workload name
+ * @param draw_line - line drawing function of line workload, NULL for text workload
+ * @param flags - text workload flags, GRAPHICS_TEXT_TRANSPARENT or GRAPHICS_TEXT_OPAQUE
+ * @param rounds - rounds of workload
+ */
+void DrawBench_Run(const char *name, DRAW_BENCH_LINE_TYPE draw_line, unsigned char flags, unsigned long rounds)
+{
+	LCD_HOST_COUNTERS_TYPE counters;
+	unsigned long calls = 0;
+	double start, time, best = 0;
+	unsigned char repeat;
+
+	for(repeat = 0; repeat < DRAW_BENCH_REPEATS; repeat++)
+	{
+		LcdHost_ResetCounters();
+		DrawBench_SinkPixels = 0;
+
+		start = DrawBench_GetTime();
+		calls = (draw_line != NULL) ? DrawBench_Lines(draw_line, rounds) : DrawBench_Text(flags, rounds);
+		time = DrawBench_GetTime() - start;
+
+		if( (repeat == 0) || (time < best) )
+		{
+			best = time;
+		}
+	}
+
+	if(GraphicDriver_GetDriver() == &DrawBench_SinkDriver)
+	{
+		printf("%-17s %7lu  %9lu  %38.2f  %9.2f\n", name, calls, DrawBench_SinkPixels, 1e3 * best,
+				1e-6 * (double)DrawBench_SinkPixels / best);
+	}
+	else
+	{
+		counters = LcdHost_GetCounters();
+		printf("%-17s %7lu  %9lu  %7lu  %7lu  %9lu  %9.2f  %9.2f\n", name, calls, counters.Pixels, counters.Points,
+				counters.Windows, counters.BytesWritten, 1e3 * best, 1e-6 * (double)counters.Pixels / best);
+	}
+}
+
+/**
+ * @brief Draw fan of lines from screen center to every DRAW_BENCH_LINE_STEP pixel of screen border
+ *
+ * @param draw_line - line drawing function
+ * @param rounds - times the fan is drawn
+ *
+ * @return number of lines drawn
+ */
+unsigned long DrawBench_Lines(DRAW_BENCH_LINE_TYPE draw_line, unsigned long rounds)
+{
+	unsigned short width = GraphicDriver_GetWidth(), height = GraphicDriver_GetHeight();
+	unsigned short x_center = width / 2, y_center = height / 2;
+	unsigned long round, calls = 0;
+	unsigned short i;
+
+	for(round = 0; round < rounds; round++)
+	{
+		for(i = 0; i < width; i += DRAW_BENCH_LINE_STEP)
+		{
+			draw_line(x_center, y_center, i, 0, (unsigned int)round);
+			draw_line(x_center, y_center, width - 1 - i, height - 1, (unsigned int)round);
+			calls += 2;
+		}
+		for(i = 0; i < height; i += DRAW_BENCH_LINE_STEP)
+		{
+			draw_line(x_center, y_center, width - 1, i, (unsigned int)round);
+			draw_line(x_center, y_center, 0, height - 1 - i, (unsigned int)round);
+			calls += 2;
+		}
+	}
+
+	return calls;
+}
+
+/**
+ * @brief Fill screen with rows of text, fonts taken in turn
+ *
+ * @param flags - GRAPHICS_TEXT_TRANSPARENT or GRAPHICS_TEXT_OPAQUE
+ * @param rounds - times the screen is filled
+ *
+ * @return number of characters drawn
+ */
+unsigned long DrawBench_Text(unsigned char flags, unsigned long rounds)
+{
+	unsigned short width = GraphicDriver_GetWidth(), height = GraphicDriver_GetHeight();
+	unsigned long round, calls = 0;
+	unsigned short y, length;
+	FONT_SIZE_TYPE font_size = FONT_8P;
+
+	for(round = 0; round < rounds; round++)
+	{
+		y = 0;
+		while(y + Graphics_GetFontHeight(font_size) <= height)
+		{
+			length = MIN(width / Graphics_GetFontWidth(font_size), sizeof(DrawBench_String) - 1);
+			Graphics_DrawString(0, y, DrawBench_String, length, font_size, 0xFFFF, (unsigned int)round, flags);
+			calls += length;
+
+			y += Graphics_GetFontHeight(font_size);
+			font_size = (font_size == FONT_16P) ? FONT_8P : (FONT_SIZE_TYPE)(font_size + 1);
+		}
+	}
+
+	return calls;
+}
+
+/**
+ * @brief Division based line rasterizer Graphics_DrawLine used before, kept as benchmark reference
+ */
+void DrawBench_DrawLineDivision(unsigned short x_start,
+								unsigned short y_start,
+								unsigned short x_end,
+								unsigned short y_end,
+								unsigned int color)
+{
+	signed short x_width = 0, y_width = 0, x_abs, y_abs;
+	signed short delta = 0;
+	unsigned short i;
+
+	x_width = x_end - x_start;
+	y_width = y_end - y_start;
+
+	x_abs = ABS(x_width);
+	y_abs = ABS(y_width);
+
+	if( x_abs > y_abs )
+	{
+		//Since horizontal width is greater than vertical, incremental step will calculated from horizontal
+		if(x_width >= 0)
+		{
+			//Line will increase x
+			for(i = 0; i < x_abs; i++)
+			{
+				delta = (i * y_width) / x_width;
+				GraphicDriver_DrawPoint(x_start + i, y_start + delta, color);
+			}
+		}
+		else
+		{
+			//Line will decrease x
+			for(i = 0; i < x_abs; i++)
+			{
+				delta = (i * y_width) / x_abs;
+				GraphicDriver_DrawPoint(x_start - i, y_start + delta, color);
+			}
+		}
+	}
+	else
+	{
+		//Since vertical width is greater than horizontal, incremental step will calculated from vertical
+		if(y_width >= 0)
+		{
+			//Line will increase y
+			for(i = 0; i < y_abs; i++)
+			{
+				delta = (i * x_width) / y_width;
+				GraphicDriver_DrawPoint(x_start + delta, y_start + i, color);
+			}
+		}
+		else
+		{
+			//Line will decrease y
+			for(i = 0; i < y_abs; i++)
+			{
+				delta = (i * x_width) / y_width;
+				GraphicDriver_DrawPoint(x_start + delta, y_start - i, color);
+			}
+		}
+	}
+}
+
+/**
+ * @brief Sink driver DrawPoint, counts the pixel
+ */
+void DrawBench_SinkPoint(unsigned short x, unsigned short y, unsigned int color)
+{
+	(void)x;
+	(void)y;
+	(void)color;
+	DrawBench_SinkPixels++;
+}
+
+/**
+ * @brief Sink driver FillRect, counts pixels of the rectangle
+ */
+void DrawBench_SinkRect(unsigned short x, unsigned short y, unsigned short width, unsigned short height, unsigned int color)
+{
+	(void)x;
+	(void)y;
+	(void)color;
+	DrawBench_SinkPixels += (unsigned long)width * height;
+}
+
+/**
+ * @brief Get monotonic time in seconds
+ */
+double DrawBench_GetTime(void)
+{
+	struct timespec now;
+
+	clock_gettime(CLOCK_MONOTONIC, &now);
+	return (double)now.tv_sec + (double)now.tv_nsec * 1e-9;
+}
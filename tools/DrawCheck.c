@@ -0,0 +1,609 @@
+/**
+ * @file DrawCheck.c
+ *
+ * @brief Host regression checks of Graphics primitives, on LcdHost driver.
+ *
+ * @details Every check draws random cases, coordinates left of or above the screen and random clip rectangles
+ * included, and compares the whole LcdHost screen after each case with a reference drawn pixel by pixel into
+ * RAM, or for opaque text with the same string drawn transparent over a filled cell area. Glyph pages of every
+ * font are compared by CRC with the pages drawn from the plain glyph tables, characters without glyph have to
+ * draw blank cells. LcdHost is wrapped by a driver counting every point and window that is not wholly on the
+ * screen. A line is printed for every check and the tool fails when any pixel or CRC differs or anything reached
+ * the driver off the screen. Built and run on the host from repository root:
+ *
+ * gcc -std=gnu99 -O2 -Isrc tools/DrawCheck.c src/Fonts.c src/GraphicDriver/FrameBuffer.c
+ * src/GraphicDriver/GraphicDriver.c src/GraphicDriver/LcdHost.c src/GraphicDriver/PixelFormat.c
+ * src/GraphicDriver/ShadowBuffer.c src/Graphics/Graphics.c -o DrawCheck
+ * ./DrawCheck
+ *
+ * Every check has to pass with any one of these added too, screen is flushed before it is compared and the
+ * reference holds native pixel values:
+ *
+ * -DFONTS_PACKED=1, also with src/FontsPacked.h of a subset written by FontPack -s
+ * -DGRAPHICS_GLYPH_CACHE_SIZE=4096
+ * -DGRAPHIC_DRIVER_FRAMEBUFFER=1
+ * -DLCD_HOST_PIXEL_FORMAT=PIXEL_FORMAT_MONO1, or any other pixel format
+ * -fsanitize=address,undefined -fno-sanitize-recover=all
+ *
+ * @author Krzysztof Grzeszczak
+ *
+ * @version 1.0
+ *
+ * @date 2012-2013
+ *
+ * @copyright GNU Public License
+ */
+
+#include "Graphics/Graphics.h"
+#include "GraphicDriver/LcdHost.h"
+#include <stdio.h>
+#include <string.h>
+
+//! Cases of line check, each draws DRAW_CHECK_CASE_LINES lines
+#define DRAW_CHECK_LINE_CASES	4000
+
+//! Lines drawn in one case of line check
+#define DRAW_CHECK_CASE_LINES	5
+
+//! Strings drawn by text check
+#define DRAW_CHECK_STRINGS		4000
+
+//! Strings drawn by opaque text check
+#define DRAW_CHECK_OPAQUE_STRINGS	3000
+
+//! CRC-32 of glyph pages of every font, as drawn from the plain glyph tables
+#define DRAW_CHECK_GLYPHS_CRC		0xF73FF406UL
+
+//! Greatest length of strings drawn by text checks
+#define DRAW_CHECK_STRING_LENGTH	8
+
+static void DrawCheck_DrawPoint(unsigned short x, unsigned short y, unsigned int color);
+static void DrawCheck_SetWindow(unsigned short x_start, unsigned short y_start, unsigned short x_end, unsigned short y_end);
+static unsigned long DrawCheck_Lines(void);
+static void DrawCheck_SetLine(int x_start, int y_start, int x_end, int y_end, unsigned short color);
+static unsigned long DrawCheck_Text(void);
+static unsigned long DrawCheck_Opaque(void);
+static unsigned long DrawCheck_Glyphs(void);
+static unsigned long DrawCheck_PageCrc(unsigned long crc);
+static unsigned long DrawCheck_Missing(void);
+static void DrawCheck_SetPixel(int x, int y, unsigned short color);
+static void DrawCheck_RandomClip(void);
+static void DrawCheck_Clear(void);
+static unsigned long DrawCheck_Compare(const char *name, unsigned long index);
+static unsigned long DrawCheck_Random(unsigned long range);
+static int DrawCheck_RandomCoordinate(int extent);
+
+static GRAPHIC_DRIVER_TYPE DrawCheck_Driver;							//!< LcdHost driver with point and window bounds counted
+static unsigned int DrawCheck_Screen[LCD_HOST_HEIGHT][LCD_HOST_WIDTH];	//!< Reference screen, native pixel values
+static int DrawCheck_ClipX, DrawCheck_ClipY, DrawCheck_ClipXEnd, DrawCheck_ClipYEnd;	//!< Clip rectangle of reference
+static unsigned long DrawCheck_OffScreen = 0;							//!< Points and windows not wholly on the screen
+static unsigned long DrawCheck_Seed = 1;								//!< State of random generator
+
+/**
+ * @brief Run every check and print a line for each
+ *
+ * @return 0 when every check passed, 1 otherwise
+ */
+int main(void)
+{
+	unsigned long differences = 0;
+
+	DrawCheck_Driver = LcdHost_Driver;
+	DrawCheck_Driver.DrawPoint = DrawCheck_DrawPoint;
+	DrawCheck_Driver.SetWindow = DrawCheck_SetWindow;
+	GraphicDriver_Initialize(&DrawCheck_Driver);
+
+	differences += DrawCheck_Lines();
+	differences += DrawCheck_Text();
+	differences += DrawCheck_Opaque();
+	differences += DrawCheck_Glyphs();
+	differences += DrawCheck_Missing();
+
+	printf("off screen: %lu points and windows\n", DrawCheck_OffScreen);
+
+	return ( (differences == 0) && (DrawCheck_OffScreen == 0) ) ? 0 : 1;
+}
+
+/**
+ * @brief LcdHost DrawPoint, points off the screen are counted
+ */
+void DrawCheck_DrawPoint(unsigned short x, unsigned short y, unsigned int color)
+{
+	if( (x >= LCD_HOST_WIDTH) || (y >= LCD_HOST_HEIGHT) )
+	{
+		DrawCheck_OffScreen++;
+	}
+	LcdHost_Driver.DrawPoint(x, y, color);
+}
+
+/**
+ * @brief LcdHost SetWindow, windows not wholly on the screen are counted
+ */
+void DrawCheck_SetWindow(unsigned short x_start, unsigned short y_start, unsigned short x_end, unsigned short y_end)
+{
+	if( (x_start > x_end) || (y_start > y_end) || (x_end >= LCD_HOST_WIDTH) || (y_end >= LCD_HOST_HEIGHT) )
+	{
+		DrawCheck_OffScreen++;
+	}
+	LcdHost_Driver.SetWindow(x_start, y_start, x_end, y_end);
+}
+
+/**
+ * @brief Draw random lines with Graphics_DrawLine in either direction, some of them long and far off the screen
+ *
+ * @details Reference computes every pixel directly, not incrementally, so the rasterizer is checked to pick
+ * the nearest pixel at every step. A line drawn end to start has to cover the same pixels, apart from the
+ * excluded end point.
+ *
+ * @return number of differing pixels
+ */
+unsigned long DrawCheck_Lines(void)
+{
+	unsigned long i, differences = 0;
+	unsigned short color;
+	unsigned char line;
+	int x_start, y_start, x_end, y_end;
+
+	for(i = 0; i < DRAW_CHECK_LINE_CASES; i++)
+	{
+		DrawCheck_Clear();
+		DrawCheck_RandomClip();
+
+		for(line = 0; line < DRAW_CHECK_CASE_LINES; line++)
+		{
+			x_start = DrawCheck_RandomCoordinate(LCD_HOST_WIDTH);
+			y_start = DrawCheck_RandomCoordinate(LCD_HOST_HEIGHT);
+			x_end = DrawCheck_RandomCoordinate(LCD_HOST_WIDTH);
+			y_end = DrawCheck_RandomCoordinate(LCD_HOST_HEIGHT);
+
+			//Some ends anywhere in coordinate range, wrapped ones are left of or above the screen
+			if(DrawCheck_Random(8) == 0)
+			{
+				x_start = (int)DrawCheck_Random(0x10000) - 0x8000;
+				y_end = (int)DrawCheck_Random(0x10000) - 0x8000;
+			}
+
+			color = (unsigned short)(DrawCheck_Random(0xFFFF) + 1);
+			Graphics_DrawLine((unsigned short)x_start, (unsigned short)y_start, (unsigned short)x_end, (unsigned short)y_end, color);
+			DrawCheck_SetLine(x_start, y_start, x_end, y_end, color);
+		}
+		Graphics_PopClip();
+
+		differences += DrawCheck_Compare("line", i);
+	}
+
+	printf("line: %u lines, %lu differing pixels\n", DRAW_CHECK_LINE_CASES * DRAW_CHECK_CASE_LINES, differences);
+	return differences;
+}
+
+/**
+ * @brief Set pixels of line in reference screen, end point excluded
+ *
+ * @details Line is stepped along its major axis from the end with lower major coordinate, step k lies at minor
+ * offset nearest to k * minor / major, halves rounded towards the lower end.
+ */
+void DrawCheck_SetLine(int x_start, int y_start, int x_end, int y_end, unsigned short color)
+{
+	int x_width = x_end - x_start, y_width = y_end - y_start;
+	int major, minor, major_first, minor_first, minor_sign, step, step_end, offset, extent;
+	bool is_x_major = ( ABS(x_width) > ABS(y_width) ) ? TRUE : FALSE;
+
+	major = (is_x_major == TRUE) ? ABS(x_width) : ABS(y_width);
+	minor = (is_x_major == TRUE) ? ABS(y_width) : ABS(x_width);
+	if(major == 0)
+	{
+		return;
+	}
+
+	if(is_x_major == TRUE)
+	{
+		major_first = MIN(x_start, x_end);
+		minor_first = (x_width < 0) ? y_end : y_start;
+		minor_sign = ( (x_width > 0) == (y_width > 0) ) ? 1 : -1;
+		step = (x_width < 0) ? 1 : 0;
+		extent = LCD_HOST_WIDTH;
+	}
+	else
+	{
+		major_first = MIN(y_start, y_end);
+		minor_first = (y_width < 0) ? x_end : x_start;
+		minor_sign = ( (y_width > 0) == (x_width > 0) ) ? 1 : -1;
+		step = (y_width < 0) ? 1 : 0;
+		extent = LCD_HOST_HEIGHT;
+	}
+
+	//Only steps on the screen along major axis are set
+	step_end = MIN(step + major, extent - major_first);
+	step = MAX(step, -major_first);
+
+	for(; step < step_end; step++)
+	{
+		offset = minor_sign * (int)( (2LL * minor * step + major - 1) / (2LL * major) );
+		if(is_x_major == TRUE)
+		{
+			DrawCheck_SetPixel(major_first + step, minor_first + offset, color);
+		}
+		else
+		{
+			DrawCheck_SetPixel(minor_first + offset, major_first + step, color);
+		}
+	}
+}
+
+/**
+ * @brief Draw random strings with Graphics_DrawString and Graphics_DrawChar, transparent and opaque
+ *
+ * @details Strings start up to a few cells left of or above the screen. Characters outside of fonts are
+ * included, they draw blank glyphs.
+ *
+ * @return number of differing pixels
+ */
+unsigned long DrawCheck_Text(void)
+{
+	const FONT_TYPE *Font;
+	FONT_SIZE_TYPE font_size;
+	char string[DRAW_CHECK_STRING_LENGTH + 1];
+	unsigned long i, differences = 0;
+	unsigned short length, color, background, mask;
+	unsigned char flags, c, row;
+	int x, y, column;
+
+	for(i = 0; i < DRAW_CHECK_STRINGS; i++)
+	{
+		DrawCheck_Clear();
+		DrawCheck_RandomClip();
+
+		font_size = (FONT_SIZE_TYPE)DrawCheck_Random(FONT_16P + 1);
+		Font = Fonts_GetFont(font_size);
+		length = (unsigned short)DrawCheck_Random(DRAW_CHECK_STRING_LENGTH) + 1;
+		for(c = 0; c < length; c++)
+		{
+			string[c] = (DrawCheck_Random(16) == 0) ? (char)(0x7F + DrawCheck_Random(0x81)) : (char)(' ' + DrawCheck_Random(95));
+		}
+		string[length] = '\0';
+
+		x = DrawCheck_RandomCoordinate(LCD_HOST_WIDTH);
+		y = DrawCheck_RandomCoordinate(LCD_HOST_HEIGHT);
+		color = (unsigned short)(DrawCheck_Random(0xFFFF) + 1);
+		background = (unsigned short)(DrawCheck_Random(0xFFFF) + 1);
+		flags = (DrawCheck_Random(2) == 0) ? GRAPHICS_TEXT_TRANSPARENT : GRAPHICS_TEXT_OPAQUE;
+
+		if( (length == 1) && (flags == GRAPHICS_TEXT_TRANSPARENT) )
+		{
+			Graphics_DrawChar((unsigned short)x, (unsigned short)y, (unsigned char)string[0], font_size, color);
+		}
+		else
+		{
+			Graphics_DrawString((unsigned short)x, (unsigned short)y, string, GRAPHICS_TEXT_TO_END, font_size, color, background, flags);
+		}
+		Graphics_PopClip();
+
+		//Cells span rows y + 1 to y + Height, glyph row 0 is the bottom one
+		for(c = 0; c < length; c++)
+		{
+			for(row = 0; row < Font->Height; row++)
+			{
+				mask = Fonts_GetRow(Font, (unsigned char)string[c], Font->Height - 1 - row);
+				for(column = 0; column < Font->Width; column++, mask >>= 1)
+				{
+					if( (mask & 0x01) != 0 )
+					{
+						DrawCheck_SetPixel(x + c * Font->Width + column, y + 1 + row, color);
+					}
+					else if(flags == GRAPHICS_TEXT_OPAQUE)
+					{
+						DrawCheck_SetPixel(x + c * Font->Width + column, y + 1 + row, background);
+					}
+				}
+			}
+		}
+
+		differences += DrawCheck_Compare("text", i);
+	}
+
+	printf("text: %u strings, %lu differing pixels\n", DRAW_CHECK_STRINGS, differences);
+	return differences;
+}
+
+/**
+ * @brief Draw random opaque strings, reference is the same string drawn transparent over its cells filled
+ *
+ * @details Reference is drawn through the same clip rectangle and read back from LcdHost, so opaque text is
+ * checked against Graphics_DrawRect and transparent text independently of Fonts_GetRow.
+ *
+ * @return number of differing pixels
+ */
+unsigned long DrawCheck_Opaque(void)
+{
+	char string[DRAW_CHECK_STRING_LENGTH + 1];
+	FONT_SIZE_TYPE font_size;
+	unsigned long i, differences = 0;
+	unsigned short length, color, background, x, y, column, row;
+	unsigned char c;
+
+	for(i = 0; i < DRAW_CHECK_OPAQUE_STRINGS; i++)
+	{
+		DrawCheck_Clear();
+		DrawCheck_RandomClip();
+
+		font_size = (FONT_SIZE_TYPE)DrawCheck_Random(FONT_16P + 1);
+		length = (unsigned short)DrawCheck_Random(DRAW_CHECK_STRING_LENGTH) + 1;
+		for(c = 0; c < length; c++)
+		{
+			string[c] = (char)(' ' + DrawCheck_Random(95));
+		}
+		string[length] = '\0';
+
+		x = (unsigned short)DrawCheck_Random(LCD_HOST_WIDTH);
+		y = (unsigned short)DrawCheck_Random(LCD_HOST_HEIGHT);
+		color = (unsigned short)(DrawCheck_Random(0xFFFF) + 1);
+		background = (unsigned short)(DrawCheck_Random(0xFFFF) + 1);
+
+		//Cells span rows y + 1 to y + Height
+		Graphics_DrawRect(x, y + 1, x + length * Graphics_GetFontWidth(font_size), y + 1 + Graphics_GetFontHeight(font_size), background);
+		Graphics_DrawString(x, y, string, length, font_size, color, background, GRAPHICS_TEXT_TRANSPARENT);
+		GraphicDriver_Flush();
+		for(row = 0; row < LCD_HOST_HEIGHT; row++)
+		{
+			for(column = 0; column < LCD_HOST_WIDTH; column++)
+			{
+				DrawCheck_Screen[row][column] = LcdHost_GetPoint(column, row);
+			}
+		}
+
+		GraphicDriver_FillRect(0, 0, LCD_HOST_WIDTH, LCD_HOST_HEIGHT, 0x0000);
+		Graphics_DrawString(x, y, string, length, font_size, color, background, GRAPHICS_TEXT_OPAQUE);
+		Graphics_PopClip();
+
+		differences += DrawCheck_Compare("opaque", i);
+	}
+
+	printf("opaque: %u strings, %lu differing pixels\n", DRAW_CHECK_OPAQUE_STRINGS, differences);
+	return differences;
+}
+
+/**
+ * @brief Draw every glyph of every font, opaque and transparent, and compare CRC of drawn pages with the expected one
+ *
+ * @details Expected CRC is taken from the plain glyph tables, so a build with FONTS_PACKED set or with glyph
+ * cache has to draw every glyph identically. Only ink is hashed, so CRC does not depend on pixel format.
+ * Fonts with a subset of characters have other pages, their CRC is printed and not checked.
+ *
+ * @return 1 when CRC differs, 0 otherwise
+ */
+unsigned long DrawCheck_Glyphs(void)
+{
+	const FONT_TYPE *Font;
+	FONT_SIZE_TYPE font_size;
+	char string[LCD_HOST_WIDTH];
+	unsigned long crc = 0xFFFFFFFFUL;
+	unsigned short c, i, y, length;
+	unsigned char flags;
+	bool is_subset = FALSE;
+
+	for(font_size = FONT_8P; font_size <= FONT_16P; font_size++)
+	{
+		Font = Fonts_GetFont(font_size);
+		if(Font->Chars != NULL)
+		{
+			is_subset = TRUE;
+		}
+
+		for(flags = GRAPHICS_TEXT_TRANSPARENT; flags <= GRAPHICS_TEXT_OPAQUE; flags++)
+		{
+			DrawCheck_Clear();
+
+			//Page of rows of as many glyphs as fit, transparent glyphs are drawn one by one
+			for(c = Font->FirstChar, y = 0; c <= Font->LastChar; c += length, y += Font->Height)
+			{
+				length = MIN(LCD_HOST_WIDTH / Font->Width, Font->LastChar - c + 1);
+				for(i = 0; i < length; i++)
+				{
+					string[i] = (char)(c + i);
+					if(flags == GRAPHICS_TEXT_TRANSPARENT)
+					{
+						Graphics_DrawChar(i * Font->Width, y, (unsigned char)(c + i), font_size, 0xFFFF);
+					}
+				}
+				if(flags == GRAPHICS_TEXT_OPAQUE)
+				{
+					Graphics_DrawString(0, y, string, length, font_size, 0xFFFF, 0x0000, GRAPHICS_TEXT_OPAQUE);
+				}
+			}
+
+			GraphicDriver_Flush();
+			crc = DrawCheck_PageCrc(crc);
+		}
+	}
+	crc ^= 0xFFFFFFFFUL;
+
+	if(is_subset == TRUE)
+	{
+		printf("glyphs: CRC %08lX, subset fonts are not checked\n", crc);
+		return 0;
+	}
+
+	printf("glyphs: CRC %08lX, expected %08lX\n", crc, DRAW_CHECK_GLYPHS_CRC);
+	return (crc == DRAW_CHECK_GLYPHS_CRC) ? 0 : 1;
+}
+
+/**
+ * @brief Update CRC-32 with one bit per LcdHost pixel, set for ink of color 0xFFFF
+ */
+unsigned long DrawCheck_PageCrc(unsigned long crc)
+{
+	unsigned int ink = GraphicDriver_GetPixelFormat()->FromRgb565(0xFFFF);
+	unsigned short x, y;
+
+	for(y = 0; y < LCD_HOST_HEIGHT; y++)
+	{
+		for(x = 0; x < LCD_HOST_WIDTH; x++)
+		{
+			crc ^= (LcdHost_GetPoint(x, y) == ink) ? 1 : 0;
+			crc = ( (crc & 0x01) != 0 ) ? (crc >> 1) ^ 0xEDB88320UL : crc >> 1;
+		}
+	}
+
+	return crc;
+}
+
+/**
+ * @brief Draw every character without glyph in a font, opaque and transparent, they have to draw blank cells
+ *
+ * @details Characters outside of FirstChar to LastChar and, in subset fonts, characters left out of Chars are
+ * drawn. Reference does not read the font, so subset builds of FontPack -s are checked too.
+ *
+ * @return number of differing pixels
+ */
+unsigned long DrawCheck_Missing(void)
+{
+	const FONT_TYPE *Font;
+	FONT_SIZE_TYPE font_size;
+	char string[2] = {0, 0};
+	unsigned long differences = 0, characters = 0;
+	unsigned short ascii_char, row, column;
+
+	for(font_size = FONT_8P; font_size <= FONT_16P; font_size++)
+	{
+		Font = Fonts_GetFont(font_size);
+		for(ascii_char = 1; ascii_char <= 0xFF; ascii_char++)
+		{
+			if( (ascii_char >= Font->FirstChar) && (ascii_char <= Font->LastChar) &&
+				( (Font->Chars == NULL) || (strchr(Font->Chars, ascii_char) != NULL) ) )
+			{
+				continue;
+			}
+
+			DrawCheck_Clear();
+			DrawCheck_ClipX = 0;
+			DrawCheck_ClipY = 0;
+			DrawCheck_ClipXEnd = LCD_HOST_WIDTH;
+			DrawCheck_ClipYEnd = LCD_HOST_HEIGHT;
+
+			string[0] = (char)ascii_char;
+			Graphics_DrawString(0, 0, string, 1, font_size, 0xFFFF, 0x001F, GRAPHICS_TEXT_OPAQUE);
+			Graphics_DrawChar(Font->Width, 0, (unsigned char)ascii_char, font_size, 0xFFFF);
+
+			for(row = 0; row < Font->Height; row++)
+			{
+				for(column = 0; column < Font->Width; column++)
+				{
+					DrawCheck_SetPixel(column, 1 + row, 0x001F);
+				}
+			}
+
+			differences += DrawCheck_Compare("missing", ascii_char);
+			characters++;
+		}
+	}
+
+	printf("missing: %lu characters, %lu differing pixels\n", characters, differences);
+	return differences;
+}
+
+/**
+ * @brief Set pixel of reference screen in native pixel format, pixels outside of reference clip rectangle are dropped
+ */
+void DrawCheck_SetPixel(int x, int y, unsigned short color)
+{
+	if( (x >= DrawCheck_ClipX) && (x < DrawCheck_ClipXEnd) && (y >= DrawCheck_ClipY) && (y < DrawCheck_ClipYEnd) )
+	{
+		DrawCheck_Screen[y][x] = GraphicDriver_GetPixelFormat()->FromRgb565(color);
+	}
+}
+
+/**
+ * @brief Push random clip rectangle, or the whole screen, and set reference clip to its intersection with the screen
+ *
+ * @details Clip rectangle is pushed in either case, so every case ends with Graphics_PopClip.
+ */
+void DrawCheck_RandomClip(void)
+{
+	unsigned short x = 0, y = 0, width = 0xFFFF, height = 0xFFFF;
+
+	if(DrawCheck_Random(2) == 0)
+	{
+		x = (unsigned short)DrawCheck_Random(LCD_HOST_WIDTH + 20);
+		y = (unsigned short)DrawCheck_Random(LCD_HOST_HEIGHT + 20);
+		width = (unsigned short)DrawCheck_Random(LCD_HOST_WIDTH);
+		height = (unsigned short)DrawCheck_Random(LCD_HOST_HEIGHT);
+	}
+	Graphics_PushClip(x, y, width, height);
+
+	DrawCheck_ClipX = MIN(x, LCD_HOST_WIDTH);
+	DrawCheck_ClipY = MIN(y, LCD_HOST_HEIGHT);
+	DrawCheck_ClipXEnd = MIN(x + width, LCD_HOST_WIDTH);
+	DrawCheck_ClipYEnd = MIN(y + height, LCD_HOST_HEIGHT);
+}
+
+/**
+ * @brief Clear LcdHost screen and reference screen
+ */
+void DrawCheck_Clear(void)
+{
+	unsigned int pixel = GraphicDriver_GetPixelFormat()->FromRgb565(0x0000);
+	unsigned short x, y;
+
+	GraphicDriver_FillRect(0, 0, LCD_HOST_WIDTH, LCD_HOST_HEIGHT, 0x0000);
+	for(y = 0; y < LCD_HOST_HEIGHT; y++)
+	{
+		for(x = 0; x < LCD_HOST_WIDTH; x++)
+		{
+			DrawCheck_Screen[y][x] = pixel;
+		}
+	}
+}
+
+/**
+ * @brief Compare LcdHost screen with reference screen, first differing pixels of a check are printed
+ *
+ * @param name - check name
+ * @param index - case of the check
+ *
+ * @return number of differing pixels
+ */
+unsigned long DrawCheck_Compare(const char *name, unsigned long index)
+{
+	static unsigned long printed = 0;
+	unsigned long differences = 0;
+	unsigned short x, y;
+	unsigned int pixel;
+
+	GraphicDriver_Flush();
+
+	for(y = 0; y < LCD_HOST_HEIGHT; y++)
+	{
+		for(x = 0; x < LCD_HOST_WIDTH; x++)
+		{
+			pixel = LcdHost_GetPoint(x, y);
+			if(pixel != DrawCheck_Screen[y][x])
+			{
+				if(printed < 10)
+				{
+					printf("%s case %lu: pixel %u,%u is %06X, expected %06X\n", name, index, x, y, pixel, DrawCheck_Screen[y][x]);
+					printed++;
+				}
+				differences++;
+			}
+		}
+	}
+
+	return differences;
+}
+
+/**
+ * @brief Get pseudo random number from 0 to range - 1, the same sequence on every host
+ */
+unsigned long DrawCheck_Random(unsigned long range)
+{
+	DrawCheck_Seed = DrawCheck_Seed * 1103515245UL + 12345UL;
+	return ( (DrawCheck_Seed >> 8) & 0xFFFFFF ) % range;
+}
+
+/**
+ * @brief Get random coordinate, mostly on the screen of defined extent, some up to 40 pixels left of or above it
+ */
+int DrawCheck_RandomCoordinate(int extent)
+{
+	return (int)DrawCheck_Random(extent + 40) - 40;
+}
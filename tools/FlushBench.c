@@ -0,0 +1,284 @@
+/**
+ * @file FlushBench.c
+ *
+ * @brief Host benchmark of frame buffer flushes against band height, on LcdHost driver.
+ *
+ * @details Renders a view of every Gui element type again and again with Gui_DrawView, which goes band by band
+ * through frame buffer, and reports per flush, i.e. per band, bus bytes and windows counted by LcdHost and
+ * time spent in LcdHost transfer entries. Panel color changes every frame, so no flush can be skipped by
+ * FRAMEBUFFER_DIFF. Band height is GRAPHIC_DRIVER_FRAMEBUFFER_LINES, fixed at compile time, so the tool is
+ * built once per value. Built and run on the host from repository root:
+ *
+ * for lines in 240 120 60 30 16 8 1; do
+ * gcc -std=gnu99 -O2 -Isrc -DGRAPHIC_DRIVER_FRAMEBUFFER=1 -DGRAPHIC_DRIVER_FRAMEBUFFER_LINES=$lines tools/FlushBench.c
+ * src/Fonts.c src/GraphicDriver/FrameBuffer.c src/GraphicDriver/GraphicDriver.c src/GraphicDriver/LcdHost.c
+ * src/GraphicDriver/PixelFormat.c src/GraphicDriver/ShadowBuffer.c src/Graphics/Graphics.c src/Gui/Gui.c
+ * src/TouchDriver/TouchDriver.c -o FlushBench
+ * ./FlushBench; done
+ *
+ * Add -DLCD_HOST_BYTE_TIME_NS=200 to include simulated bus time of 40 MHz SPI in the flush time.
+ * Number of frames may be given as the only argument.
+ *
+ * @author Krzysztof Grzeszczak
+ *
+ * @version 1.0
+ *
+ * @date 2012-2013
+ *
+ * @copyright GNU Public License
+ */
+
+#include "Gui/Gui.h"
+#include "GraphicDriver/LcdHost.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+
+//! Frames rendered when none are given
+#define FLUSH_BENCH_FRAMES		200
+
+static void FlushBench_SetWindow(unsigned short x_start, unsigned short y_start, unsigned short x_end, unsigned short y_end);
+static void FlushBench_WritePixels(const void *pixels, unsigned int count);
+static void FlushBench_WriteColor(unsigned int color, unsigned int count);
+static void FlushBench_EndWindow(void);
+#if (LCD_HOST_ASYNC_SUPPORT != 0)
+static void FlushBench_WritePixelsAsync(const void *pixels, unsigned int count);
+static void FlushBench_Idle(void);
+#endif
+static double FlushBench_GetTime(void);
+static GUI_PANEL_TYPE* FlushBench_CreateView(GUI_VIEW_TYPE *View);
+
+static GRAPHIC_DRIVER_TYPE FlushBench_Driver;			//!< LcdHost driver with transfer entries timed
+static double FlushBench_TransferTime = 0;				//!< Seconds spent in LcdHost transfer entries
+
+/**
+ * @brief Render view for defined number of frames and print bytes, windows and time per flush
+ *
+ * @return 0 on success, 1 on bad argument
+ */
+int main(int argc, char *argv[])
+{
+	static GUI_VIEW_TYPE View;
+	GUI_PANEL_TYPE *Panel;
+	LCD_HOST_COUNTERS_TYPE counters;
+	unsigned long frames = FLUSH_BENCH_FRAMES, flushes, frame;
+	unsigned short bands;
+	double start, total;
+
+	if(argc > 2)
+	{
+		fprintf(stderr, "usage: %s [frames]\n", argv[0]);
+		return 1;
+	}
+	if(argc == 2)
+	{
+		frames = strtoul(argv[1], NULL, 10);
+		if(frames == 0)
+		{
+			fprintf(stderr, "%s: expected number of frames\n", argv[1]);
+			return 1;
+		}
+	}
+
+	FlushBench_Driver = LcdHost_Driver;
+	FlushBench_Driver.SetWindow = FlushBench_SetWindow;
+	FlushBench_Driver.WritePixels = FlushBench_WritePixels;
+	FlushBench_Driver.WriteColor = FlushBench_WriteColor;
+	FlushBench_Driver.EndWindow = FlushBench_EndWindow;
+#if (LCD_HOST_ASYNC_SUPPORT != 0)
+	FlushBench_Driver.WritePixelsAsync = FlushBench_WritePixelsAsync;
+	FlushBench_Driver.Idle = FlushBench_Idle;
+#endif
+	GraphicDriver_Initialize(&FlushBench_Driver);
+
+	View = VIEW_DEFAULT;
+	Panel = FlushBench_CreateView(&View);
+
+	//First frame sends the whole screen with every FRAMEBUFFER_DIFF setting, it is not counted
+	Gui_DrawView(&View);
+	GraphicDriver_Flush();
+
+	LcdHost_ResetCounters();
+	FlushBench_TransferTime = 0;
+	start = FlushBench_GetTime();
+	for(frame = 0; frame < frames; frame++)
+	{
+		Panel->Color ^= 0xFFFF;
+		Gui_DrawView(&View);
+	}
+	GraphicDriver_Flush();
+	total = FlushBench_GetTime() - start;
+	counters = LcdHost_GetCounters();
+
+	bands = (GraphicDriver_GetHeight() + GraphicDriver_GetBandHeight() - 1) / GraphicDriver_GetBandHeight();
+	flushes = frames * bands;
+
+	printf("lines %3u  bands %3u  flushes %6lu  bytes/flush %7.0f  windows/flush %5.1f  flush us %8.2f  frame us %9.2f  flush share %3.0f %%\n",
+			GraphicDriver_GetBandHeight(), bands, flushes,
+			(double)counters.BytesWritten / (double)flushes, (double)counters.Windows / (double)flushes,
+			1e6 * FlushBench_TransferTime / (double)flushes, 1e6 * total / (double)frames,
+			100.0 * FlushBench_TransferTime / total);
+
+	return 0;
+}
+
+/**
+ * @brief Timed LcdHost SetWindow
+ */
+void FlushBench_SetWindow(unsigned short x_start, unsigned short y_start, unsigned short x_end, unsigned short y_end)
+{
+	double start = FlushBench_GetTime();
+
+	LcdHost_Driver.SetWindow(x_start, y_start, x_end, y_end);
+	FlushBench_TransferTime += FlushBench_GetTime() - start;
+}
+
+/**
+ * @brief Timed LcdHost WritePixels
+ */
+void FlushBench_WritePixels(const void *pixels, unsigned int count)
+{
+	double start = FlushBench_GetTime();
+
+	LcdHost_Driver.WritePixels(pixels, count);
+	FlushBench_TransferTime += FlushBench_GetTime() - start;
+}
+
+/**
+ * @brief Timed LcdHost WriteColor
+ */
+void FlushBench_WriteColor(unsigned int color, unsigned int count)
+{
+	double start = FlushBench_GetTime();
+
+	LcdHost_Driver.WriteColor(color, count);
+	FlushBench_TransferTime += FlushBench_GetTime() - start;
+}
+
+/**
+ * @brief Timed LcdHost EndWindow
+ */
+void FlushBench_EndWindow(void)
+{
+	double start = FlushBench_GetTime();
+
+	LcdHost_Driver.EndWindow();
+	FlushBench_TransferTime += FlushBench_GetTime() - start;
+}
+
+#if (LCD_HOST_ASYNC_SUPPORT != 0)
+/**
+ * @brief Timed LcdHost WritePixelsAsync, only the start of the stream is timed
+ */
+void FlushBench_WritePixelsAsync(const void *pixels, unsigned int count)
+{
+	double start = FlushBench_GetTime();
+
+	LcdHost_Driver.WritePixelsAsync(pixels, count);
+	FlushBench_TransferTime += FlushBench_GetTime() - start;
+}
+
+/**
+ * @brief Timed LcdHost Idle, time drawing waits for the stream to finish
+ */
+void FlushBench_Idle(void)
+{
+	double start = FlushBench_GetTime();
+
+	LcdHost_Driver.Idle();
+	FlushBench_TransferTime += FlushBench_GetTime() - start;
+}
+#endif
+
+/**
+ * @brief Get monotonic time in seconds
+ */
+double FlushBench_GetTime(void)
+{
+	struct timespec now;
+
+	clock_gettime(CLOCK_MONOTONIC, &now);
+	return (double)now.tv_sec + (double)now.tv_nsec * 1e-9;
+}
+
+/**
+ * @brief Fill view with full screen panel and elements of every type
+ *
+ * @return full screen panel
+ */
+GUI_PANEL_TYPE* FlushBench_CreateView(GUI_VIEW_TYPE *View)
+{
+	GUI_PANEL_TYPE *Panel;
+	GUI_LABEL_TYPE *Label;
+	GUI_BUTTON_TYPE *Button;
+	GUI_SLIDER_TYPE *Slider;
+	GUI_CHECKBOX_TYPE *Checkbox;
+	GUI_LED_TYPE *Led;
+	GUI_TEXTBOX_TYPE *TextBox;
+
+	Panel = Gui_NewPanel(View);
+	Panel->Width = GraphicDriver_GetWidth();
+	Panel->Height = GraphicDriver_GetHeight();
+	Panel->Color = 0x18E3;
+
+	Label = Gui_NewLabel(View);
+	Label->String = "Flush benchmark";
+	Label->FontSize = FONT_16P;
+	Label->XPos = 10;
+	Label->YPos = 10;
+	Label->Width = 200;
+	Label->Height = 28;
+	Label->IsBackground = TRUE;
+	Label->BackgroundColor = 0x4208;
+	Label->FontColor = 0xFFE0;
+	Label->Align = ALIGN_CENTER;
+
+	Label = Gui_NewLabel(View);
+	Label->String = "Band by band";
+	Label->FontSize = FONT_12P;
+	Label->XPos = 10;
+	Label->YPos = 50;
+	Label->Width = 200;
+	Label->Height = 16;
+	Label->FontColor = 0x07E0;
+	Label->Align = ALIGN_LEFT;
+
+	Button = Gui_NewButton(View);
+	Button->XPos = 220;
+	Button->YPos = 10;
+	Button->Width = 90;
+	Button->Height = 30;
+	Button->ButtonColor = 0x8410;
+	Button->caption.String = "OK";
+	Button->caption.FontSize = FONT_12P;
+
+	Slider = Gui_NewSlider(View);
+	Slider->XPos = 10;
+	Slider->YPos = 110;
+	Slider->Width = 200;
+	Slider->Height = 20;
+	Slider->Value = 40;
+	Slider->Color = 0xC618;
+
+	Checkbox = Gui_NewCheckbox(View);
+	Checkbox->XPos = 220;
+	Checkbox->YPos = 100;
+	Checkbox->Size = 15;
+	Checkbox->IsChecked = TRUE;
+
+	Led = Gui_NewLed(View);
+	Led->XPos = 250;
+	Led->YPos = 100;
+	Led->Size = 15;
+	Led->IsOn = TRUE;
+
+	TextBox = Gui_NewTextBox(View);
+	TextBox->XPos = 10;
+	TextBox->YPos = 140;
+	TextBox->Width = 270;
+	TextBox->Height = 90;
+	TextBox->FontSize = FONT_8P;
+	Gui_TextBoxSetString(TextBox, "The quick brown fox jumps over the lazy dog 0123456789");
+
+	return Panel;
+}
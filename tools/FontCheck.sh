@@ -0,0 +1,88 @@
+#!/bin/sh
+#
+# @file FontCheck.sh
+#
+# @brief Host check that every glyph table ends up once in the image.
+#
+# @details Compiles every module of src, links them and lists symbols of every object and of the linked
+# image with nm. Glyph tables and font descriptor table of Fonts.c are static, so each object keeps its
+# own local symbol for a copy it carries. Check fails when an object other than Fonts.o defines a table,
+# when a table symbol is found more than once in the image or when no table is found at all. Sizes of
+# the tables found are reported. Default -O0 keeps every unused static, the worst case for copies.
+#
+# Run from repository root, compiler, nm and flags may be given in environment:
+#
+# tools/FontCheck.sh
+# CFLAGS="-Os -DFONTS_PACKED=1" tools/FontCheck.sh
+#
+# @author Krzysztof Grzeszczak
+#
+# @version 1.0
+#
+# @date 2012-2013
+#
+# @copyright GNU Public License
+#
+
+CC=${CC:-gcc}
+NM=${NM:-nm}
+CFLAGS=${CFLAGS:--O0}
+LDLIBS=${LDLIBS:--lpthread}
+
+#Symbols of glyph tables, plain and packed, and of font descriptor table
+TABLES='^(Font_[0-9a-z_]+_(Ascii_Table|Packed_Rows|Packed_Index|Packed_Chars)|Fonts_Table)$'
+
+WORK=$(mktemp -d) || exit 1
+trap 'rm -rf "$WORK"' EXIT
+
+status=0
+
+for source in $(find src -name '*.c' | sort)
+do
+	object="$WORK/$(basename "$source" .c).o"
+	if ! $CC -std=gnu99 -w $CFLAGS -Isrc -c "$source" -o "$object"
+	then
+		echo "$source: does not compile"
+		exit 1
+	fi
+
+	#Tables defined in the object, local or global, data or text
+	found=$($NM "$object" | awk '$2 ~ /^[rRdDtT]$/ {print $3}' | grep -E "$TABLES")
+	if [ -n "$found" ] && [ "$(basename "$object")" != "Fonts.o" ]
+	then
+		echo "$source: carries its own copy of" $found
+		status=1
+	fi
+done
+
+if ! $CC $CFLAGS "$WORK"/*.o -o "$WORK/image" $LDLIBS
+then
+	echo "image: does not link"
+	exit 1
+fi
+
+$NM -S --size-sort "$WORK/image" | awk 'NF == 4 && $3 ~ /^[rRdDtT]$/ {print $4, $2}' | grep -E "${TABLES%$}"' ' > "$WORK/tables"
+
+if [ ! -s "$WORK/tables" ]
+then
+	echo "image: no font table found"
+	exit 1
+fi
+
+for name in $(cut -d ' ' -f 1 "$WORK/tables" | sort -u)
+do
+	copies=$(grep -c "^$name " "$WORK/tables")
+	bytes=$(grep "^$name " "$WORK/tables" | head -n 1 | cut -d ' ' -f 2)
+	printf '%-26s %6d bytes  %d cop%s\n' "$name" "$((0x$bytes))" "$copies" "$( [ "$copies" -eq 1 ] && echo y || echo ies )"
+	if [ "$copies" -ne 1 ]
+	then
+		status=1
+	fi
+done
+
+if [ $status -eq 0 ]
+then
+	echo "every font table is linked once"
+fi
+
+exit $status
@@ -0,0 +1,818 @@
+/**
+ * @file FontPack.c
+ *
+ * @brief Host tool generating packed glyph tables, from fonts of Fonts.c or from BDF and TTF files.
+ *
+ * @details Writes FontsPacked.h, used by Fonts.c when FONTS_PACKED is set, in the format described in Fonts.c.
+ * Every font of FONT_SIZE_TYPE is taken from plain tables of Fonts.c unless a file is given for it:
+ *
+ * -f 16p=font.bdf		BDF font, glyph cell is FONTBOUNDINGBOX
+ * -f 16p=font.ttf:24	TTF font rasterized at 24 pixels, tool built with FONT_PACK_FREETYPE set
+ *
+ * Slots are 8p, 8p_bold, 12p and 16p, cells up to 16 pixels wide and 32 high. With -s option only glyphs of
+ * printable characters found in a string table file, e.g. one string of application per line, are kept,
+ * Fonts.c draws other characters blank. Every packed glyph is decoded again and compared with its source
+ * before anything is written. With -b option flash taken and decode time per glyph are reported on stderr.
+ * With -e option font of a slot is written as BDF instead, e.g. to edit it or to check BDF reading by round trip,
+ * whose tables differ from those packed from Fonts.c in nothing but the source named in the header comment:
+ *
+ * ./FontPack -e 12p > 12p.bdf
+ * ./FontPack > plain.h
+ * ./FontPack -f 12p=12p.bdf | diff plain.h -
+ *
+ * Built and run on the host from repository root, against Fonts.c with plain tables:
+ *
+ * gcc -std=gnu99 -O2 -Isrc tools/FontPack.c src/Fonts.c -o FontPack
+ * ./FontPack -b > src/FontsPacked.h
+ *
+ * With TTF support:
+ *
+ * gcc -std=gnu99 -O2 -Isrc -DFONT_PACK_FREETYPE=1 $(pkg-config --cflags freetype2) tools/FontPack.c src/Fonts.c
+ * -o FontPack $(pkg-config --libs freetype2)
+ *
+ * @author Krzysztof Grzeszczak
+ *
+ * @version 1.0
+ *
+ * @date 2012-2013
+ *
+ * @copyright GNU Public License
+ */
+
+#include "Fonts.h"
+#include <ctype.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+//! Rasterize TTF fonts with FreeType library
+#ifndef FONT_PACK_FREETYPE
+#define FONT_PACK_FREETYPE		0
+#endif
+
+#if (FONT_PACK_FREETYPE != 0)
+#include <ft2build.h>
+#include FT_FREETYPE_H
+#endif
+
+//! Number of fonts, slots of FONT_SIZE_TYPE
+#define FONT_PACK_FONTS			4
+
+//! Glyphs of characters ' ' to '~' read from files
+#define FONT_PACK_GLYPHS		95
+
+//! Greatest cell width, glyph rows are 16-bit masks
+#define FONT_PACK_MAX_WIDTH		16
+
+//! Greatest cell height
+#define FONT_PACK_MAX_HEIGHT	32
+
+//! Bytes of packed data of one font
+#define FONT_PACK_MAX_BYTES		16384
+
+//! Decodes of every glyph timed by benchmark
+#define FONT_PACK_BENCH_ROUNDS	20000
+
+//! Font read from file, 16-bit rows of characters ' ' to '~', leftmost pixel in bit 0
+typedef struct
+{
+	FONT_TYPE Font;
+	unsigned short Rows[FONT_PACK_GLYPHS * FONT_PACK_MAX_HEIGHT];
+	const char *Path;
+} FONT_PACK_SOURCE_TYPE;
+
+//! Packed font being built
+typedef struct
+{
+	FONT_TYPE Font;							//Descriptor of packed font
+	unsigned char Rows[FONT_PACK_MAX_BYTES];
+	unsigned short Index[256];
+	char Chars[256];						//Characters with glyph, NUL terminated
+	unsigned short Count;					//Number of glyphs
+	unsigned long Bit;						//Next bit to write to Rows
+} FONT_PACK_TYPE;
+
+//! Names of fonts and slots of -f option in FONT_SIZE_TYPE order
+static const char *FontPack_Names[FONT_PACK_FONTS] = {"Font_8p", "Font_8p_bold", "Font_12p", "Font_16p"};
+static const char *FontPack_Slots[FONT_PACK_FONTS] = {"8p", "8p_bold", "12p", "16p"};
+
+static FONT_PACK_SOURCE_TYPE FontPack_Sources[FONT_PACK_FONTS];		//!< Fonts read from files
+static FONT_PACK_TYPE FontPack_Packs[FONT_PACK_FONTS];				//!< Packed fonts
+static bool FontPack_IsUsed[256];									//!< Characters kept in packed fonts
+static bool FontPack_IsSubset = FALSE;								//!< Characters taken from string table
+static volatile unsigned short FontPack_Sink;						//!< Keeps benchmarked reads
+
+static bool FontPack_ReadStrings(const char *path);
+static unsigned int FontPack_FindSlot(const char *slot, size_t length);
+static bool FontPack_ReadFont(const char *argument);
+static bool FontPack_ReadBdf(FILE *file, FONT_PACK_SOURCE_TYPE *Source);
+#if (FONT_PACK_FREETYPE != 0)
+static bool FontPack_ReadTtf(const char *path, unsigned int pixels, FONT_PACK_SOURCE_TYPE *Source);
+#endif
+static void FontPack_WriteBdf(const char *name, const FONT_TYPE *Font);
+static bool FontPack_IsExported(const FONT_TYPE *Font, unsigned int ascii_char);
+static unsigned short FontPack_Reverse(unsigned short bits, unsigned char count);
+static void FontPack_SetPixel(FONT_PACK_SOURCE_TYPE *Source, unsigned int ascii_char, int column, int row);
+static void FontPack_Pack(FONT_PACK_TYPE *Pack, const FONT_TYPE *Font);
+static void FontPack_WriteBits(FONT_PACK_TYPE *Pack, unsigned short bits, unsigned char count);
+static void FontPack_PackGlyph(FONT_PACK_TYPE *Pack, const FONT_TYPE *Font, unsigned char ascii_char);
+static bool FontPack_Verify(const FONT_TYPE *Font, const FONT_TYPE *Packed);
+static double FontPack_Bench(const FONT_TYPE *Font);
+static void FontPack_Print(const char *name, const FONT_PACK_TYPE *Pack);
+
+/**
+ * @brief Read options, pack glyph tables of all fonts, verify them and write FontsPacked.h to stdout, or write font
+ * of one slot as BDF
+ *
+ * @return 0 on success, 1 on bad option or file, or when packed glyph does not decode to its source
+ */
+int main(int argc, char *argv[])
+{
+	const FONT_TYPE *Font;
+	unsigned long plain_bytes, packed_bytes;
+	unsigned int font_size, ascii_char, export_size = FONT_PACK_FONTS;
+	bool is_bench = FALSE;
+	int i;
+
+	for(ascii_char = 0; ascii_char < 256; ascii_char++)
+	{
+		FontPack_IsUsed[ascii_char] = TRUE;
+	}
+
+	for(i = 1; i < argc; i++)
+	{
+		if(strcmp(argv[i], "-b") == 0)
+		{
+			is_bench = TRUE;
+		}
+		else if( (strcmp(argv[i], "-s") == 0) && (i + 1 < argc) )
+		{
+			if(FontPack_ReadStrings(argv[++i]) == FALSE)
+			{
+				return 1;
+			}
+		}
+		else if( (strcmp(argv[i], "-f") == 0) && (i + 1 < argc) )
+		{
+			if(FontPack_ReadFont(argv[++i]) == FALSE)
+			{
+				return 1;
+			}
+		}
+		else if( (strcmp(argv[i], "-e") == 0) && (i + 1 < argc) )
+		{
+			export_size = FontPack_FindSlot(argv[i + 1], strlen(argv[i + 1]));
+			if(export_size == FONT_PACK_FONTS)
+			{
+				fprintf(stderr, "%s: expected 8p, 8p_bold, 12p or 16p\n", argv[i + 1]);
+				return 1;
+			}
+			i++;
+		}
+		else
+		{
+			fprintf(stderr, "usage: %s [-b] [-s strings.txt] [-f slot=font.bdf] [-f slot=font.ttf:pixels] > FontsPacked.h\n"
+					"       %s [-s strings.txt] [-f slot=font.bdf] [-f slot=font.ttf:pixels] -e slot > font.bdf\n", argv[0], argv[0]);
+			return 1;
+		}
+	}
+
+	if(export_size < FONT_PACK_FONTS)
+	{
+		Font = (FontPack_Sources[export_size].Path != NULL) ? &FontPack_Sources[export_size].Font : Fonts_GetFont((FONT_SIZE_TYPE)export_size);
+		FontPack_WriteBdf(FontPack_Names[export_size], Font);
+		return 0;
+	}
+
+	for(font_size = 0; font_size < FONT_PACK_FONTS; font_size++)
+	{
+		Font = (FontPack_Sources[font_size].Path != NULL) ? &FontPack_Sources[font_size].Font : Fonts_GetFont((FONT_SIZE_TYPE)font_size);
+
+		FontPack_Pack(&FontPack_Packs[font_size], Font);
+		if(FontPack_Verify(Font, &FontPack_Packs[font_size].Font) == FALSE)
+		{
+			fprintf(stderr, "%s: packed glyph differs from its source\n", FontPack_Names[font_size]);
+			return 1;
+		}
+	}
+
+	printf("/**\n"
+			" * @file FontsPacked.h\n"
+			" *\n"
+			" * @brief Glyph tables packed to glyph bounds, generated by tools/FontPack.\n"
+			" *\n"
+			" * @details Included by Fonts.c only, when FONTS_PACKED is set. Run FontPack again instead of editing.\n"
+			" *\n");
+	for(font_size = 0; font_size < FONT_PACK_FONTS; font_size++)
+	{
+		printf(" * %s from %s, %u glyphs\n", FontPack_Names[font_size],
+				(FontPack_Sources[font_size].Path != NULL) ? FontPack_Sources[font_size].Path : "Fonts.c", FontPack_Packs[font_size].Count);
+	}
+	printf(" */\n\n");
+
+	for(font_size = 0; font_size < FONT_PACK_FONTS; font_size++)
+	{
+		FontPack_Print(FontPack_Names[font_size], &FontPack_Packs[font_size]);
+	}
+
+	printf("//! Font descriptors in FONT_SIZE_TYPE order\nstatic const FONT_TYPE Fonts_Table[] =\n{\n");
+	for(font_size = 0; font_size < FONT_PACK_FONTS; font_size++)
+	{
+		Font = &FontPack_Packs[font_size].Font;
+		printf("\t{%u, %u, %u, %u, FALSE, NULL, NULL, %s_Packed_Rows, %s_Packed_Index, ",
+				Font->Width, Font->Height, Font->FirstChar, Font->LastChar, FontPack_Names[font_size], FontPack_Names[font_size]);
+		if(FontPack_IsSubset == TRUE)
+		{
+			printf("%s_Packed_Chars}", FontPack_Names[font_size]);
+		}
+		else
+		{
+			printf("NULL}");
+		}
+		printf("%s\t//%s\n", (font_size + 1 < FONT_PACK_FONTS) ? "," : "", FontPack_Slots[font_size]);
+	}
+	printf("};\n");
+
+	if(is_bench == TRUE)
+	{
+		fprintf(stderr, "font           glyphs  plain B  packed B  saved   plain ns/glyph  packed ns/glyph\n");
+		for(font_size = 0; font_size < FONT_PACK_FONTS; font_size++)
+		{
+			Font = (FontPack_Sources[font_size].Path != NULL) ? &FontPack_Sources[font_size].Font : Fonts_GetFont((FONT_SIZE_TYPE)font_size);
+
+			//Plain tables hold every character of the range, with rows of 8 or 16 bits
+			plain_bytes = (unsigned long)(Font->LastChar - Font->FirstChar + 1) * Font->Height * ( (Font->Width > 8) ? 2 : 1 );
+			packed_bytes = FontPack_Packs[font_size].Bit / 8 + FontPack_Packs[font_size].Count * sizeof(unsigned short);
+			if(FontPack_IsSubset == TRUE)
+			{
+				packed_bytes += FontPack_Packs[font_size].Count + 1;
+			}
+
+			fprintf(stderr, "%-14s %6u  %7lu  %8lu  %4.0f %%  %14.1f  %15.1f\n", FontPack_Names[font_size], FontPack_Packs[font_size].Count,
+					plain_bytes, packed_bytes, 100.0 * ( (double)plain_bytes - (double)packed_bytes ) / (double)plain_bytes,
+					FontPack_Bench(Font), FontPack_Bench(&FontPack_Packs[font_size].Font));
+		}
+	}
+
+	return 0;
+}
+
+/**
+ * @brief Keep glyphs of printable characters found in string table file only
+ */
+bool FontPack_ReadStrings(const char *path)
+{
+	FILE *file = fopen(path, "rb");
+	unsigned int ascii_char;
+	int read_char;
+
+	if(file == NULL)
+	{
+		fprintf(stderr, "%s: cannot open\n", path);
+		return FALSE;
+	}
+
+	for(ascii_char = 0; ascii_char < 256; ascii_char++)
+	{
+		FontPack_IsUsed[ascii_char] = FALSE;
+	}
+
+	while( (read_char = fgetc(file)) != EOF )
+	{
+		if( (read_char >= ' ') && (read_char <= '~') )
+		{
+			FontPack_IsUsed[read_char] = TRUE;
+		}
+	}
+	fclose(file);
+
+	FontPack_IsSubset = TRUE;
+	return TRUE;
+}
+
+/**
+ * @brief Find slot of -f and -e options by name
+ *
+ * @param length - length of name at slot
+ *
+ * @return font size of slot, FONT_PACK_FONTS for unknown name
+ */
+unsigned int FontPack_FindSlot(const char *slot, size_t length)
+{
+	unsigned int font_size;
+
+	for(font_size = 0; font_size < FONT_PACK_FONTS; font_size++)
+	{
+		if( (strlen(FontPack_Slots[font_size]) == length) && (strncmp(slot, FontPack_Slots[font_size], length) == 0) )
+		{
+			break;
+		}
+	}
+
+	return font_size;
+}
+
+/**
+ * @brief Read font of slot from BDF file, or from TTF file when argument ends with :pixels
+ *
+ * @param argument - slot=path or slot=path:pixels
+ */
+bool FontPack_ReadFont(const char *argument)
+{
+	FONT_PACK_SOURCE_TYPE *Source = NULL;
+	const char *path = strchr(argument, '=');
+	const char *size;
+	char name[256];
+	unsigned int font_size;
+	bool is_read;
+	FILE *file;
+
+	font_size = (path != NULL) ? FontPack_FindSlot(argument, (size_t)(path - argument)) : FONT_PACK_FONTS;
+	if(font_size < FONT_PACK_FONTS)
+	{
+		Source = &FontPack_Sources[font_size];
+	}
+	if( (Source == NULL) || (strlen(path + 1) >= sizeof(name)) )
+	{
+		fprintf(stderr, "%s: expected 8p, 8p_bold, 12p or 16p=file\n", argument);
+		return FALSE;
+	}
+
+	strcpy(name, path + 1);
+	Source->Path = path + 1;
+	size = strrchr(name, ':');
+	if(size != NULL)
+	{
+		name[size - name] = '\0';
+#if (FONT_PACK_FREETYPE != 0)
+		is_read = FontPack_ReadTtf(name, (unsigned int)atoi(size + 1), Source);
+#else
+		fprintf(stderr, "%s: TTF fonts need FontPack built with FONT_PACK_FREETYPE set\n", name);
+		is_read = FALSE;
+#endif
+	}
+	else
+	{
+		file = fopen(name, "r");
+		if(file == NULL)
+		{
+			fprintf(stderr, "%s: cannot open\n", name);
+			return FALSE;
+		}
+		is_read = FontPack_ReadBdf(file, Source);
+		fclose(file);
+	}
+
+	if( (is_read == TRUE) && ( (Source->Font.Width > FONT_PACK_MAX_WIDTH) || (Source->Font.Height > FONT_PACK_MAX_HEIGHT) ||
+		(Source->Font.Width == 0) || (Source->Font.Height == 0) ) )
+	{
+		fprintf(stderr, "%s: %ux%u cell, up to %ux%u fits\n", name, Source->Font.Width, Source->Font.Height,
+				FONT_PACK_MAX_WIDTH, FONT_PACK_MAX_HEIGHT);
+		is_read = FALSE;
+	}
+
+	return is_read;
+}
+
+/**
+ * @brief Read glyphs of characters ' ' to '~' from BDF font, cell is FONTBOUNDINGBOX
+ *
+ * @details First bitmap row of glyph goes to glyph row 0, as in plain tables of Fonts.c.
+ */
+bool FontPack_ReadBdf(FILE *file, FONT_PACK_SOURCE_TYPE *Source)
+{
+	char line[256];
+	int width = 0, height = 0, x_offset = 0, y_offset = 0;
+	int encoding = -1, glyph_width = 0, glyph_height = 0, glyph_x = 0, glyph_y = 0;
+	int row = -1, column, digits;
+	unsigned long bits;
+
+	while(fgets(line, sizeof(line), file) != NULL)
+	{
+		if(sscanf(line, "FONTBOUNDINGBOX %d %d %d %d", &width, &height, &x_offset, &y_offset) == 4)
+		{
+			Source->Font.Width = (unsigned char)( (width > 0xFF) ? 0xFF : width );
+			Source->Font.Height = (unsigned char)( (height > 0xFF) ? 0xFF : height );
+			if( (width > FONT_PACK_MAX_WIDTH) || (height > FONT_PACK_MAX_HEIGHT) )
+			{
+				return TRUE;
+			}
+		}
+		else if(sscanf(line, "ENCODING %d", &encoding) == 1)
+		{
+			do{}while(0);
+		}
+		else if(sscanf(line, "BBX %d %d %d %d", &glyph_width, &glyph_height, &glyph_x, &glyph_y) == 4)
+		{
+			do{}while(0);
+		}
+		else if(strncmp(line, "BITMAP", 6) == 0)
+		{
+			row = 0;
+		}
+		else if(strncmp(line, "ENDCHAR", 7) == 0)
+		{
+			row = -1;
+		}
+		else if( (row >= 0) && (row < glyph_height) && (encoding >= ' ') && (encoding <= '~') )
+		{
+			//Bitmap row is hex, leftmost pixel in the top bit of its bytes
+			for(digits = 0; isxdigit((unsigned char)line[digits]); digits++)
+			{
+				do{}while(0);
+			}
+			bits = strtoul(line, NULL, 16);
+			for(column = 0; (column < glyph_width) && (column < digits * 4); column++)
+			{
+				if( ( (bits >> (digits * 4 - 1 - column)) & 0x01 ) != 0 )
+				{
+					FontPack_SetPixel(Source, encoding, glyph_x - x_offset + column,
+									y_offset + height - glyph_y - glyph_height + row);
+				}
+			}
+			row++;
+		}
+	}
+
+	if( (width == 0) || (height == 0) )
+	{
+		fprintf(stderr, "BDF font without FONTBOUNDINGBOX\n");
+		return FALSE;
+	}
+
+	Source->Font.FirstChar = ' ';
+	Source->Font.LastChar = '~';
+	Source->Font.IsMsbFirst = FALSE;
+	Source->Font.WideRows = Source->Rows;
+	return TRUE;
+}
+
+#if (FONT_PACK_FREETYPE != 0)
+/**
+ * @brief Rasterize glyphs of characters ' ' to '~' of TTF font, cell spans ascender to descender and widest advance
+ * of these characters
+ */
+bool FontPack_ReadTtf(const char *path, unsigned int pixels, FONT_PACK_SOURCE_TYPE *Source)
+{
+	FT_Library Library;
+	FT_Face Face;
+	FT_Bitmap *Bitmap;
+	unsigned int ascii_char, row, column;
+	long width = 0;
+	int ascender;
+
+	if( (FT_Init_FreeType(&Library) != 0) || (FT_New_Face(Library, path, 0, &Face) != 0) ||
+		(FT_Set_Pixel_Sizes(Face, 0, pixels) != 0) )
+	{
+		fprintf(stderr, "%s: cannot open font at %u pixels\n", path, pixels);
+		return FALSE;
+	}
+
+	//Metrics are 26.6 fixed point, cell is as wide as the widest advance of characters read
+	ascender = (int)( (Face->size->metrics.ascender + 63) >> 6 );
+	Source->Font.Height = (unsigned char)( ascender - (int)(Face->size->metrics.descender >> 6) );
+	for(ascii_char = ' '; ascii_char <= '~'; ascii_char++)
+	{
+		if( (FT_Load_Char(Face, ascii_char, FT_LOAD_DEFAULT) == 0) && ( ((Face->glyph->advance.x + 63) >> 6) > width ) )
+		{
+			width = (Face->glyph->advance.x + 63) >> 6;
+		}
+	}
+	Source->Font.Width = (unsigned char)( (width > 0xFF) ? 0xFF : width );
+	if( (Source->Font.Width <= FONT_PACK_MAX_WIDTH) && (Source->Font.Height <= FONT_PACK_MAX_HEIGHT) )
+	{
+		for(ascii_char = ' '; ascii_char <= '~'; ascii_char++)
+		{
+			if(FT_Load_Char(Face, ascii_char, FT_LOAD_RENDER | FT_LOAD_MONOCHROME | FT_LOAD_TARGET_MONO) != 0)
+			{
+				continue;
+			}
+
+			Bitmap = &Face->glyph->bitmap;
+			for(row = 0; row < Bitmap->rows; row++)
+			{
+				for(column = 0; column < Bitmap->width; column++)
+				{
+					if( (Bitmap->buffer[row * Bitmap->pitch + column / 8] & (0x80 >> (column % 8))) != 0 )
+					{
+						FontPack_SetPixel(Source, ascii_char, Face->glyph->bitmap_left + (int)column,
+										ascender - Face->glyph->bitmap_top + (int)row);
+					}
+				}
+			}
+		}
+	}
+
+	FT_Done_Face(Face);
+	FT_Done_FreeType(Library);
+
+	Source->Font.FirstChar = ' ';
+	Source->Font.LastChar = '~';
+	Source->Font.IsMsbFirst = FALSE;
+	Source->Font.WideRows = Source->Rows;
+	return TRUE;
+}
+#endif
+
+/**
+ * @brief Write glyphs of characters ' ' to '~' in use as BDF font to stdout, one bitmap per cell
+ *
+ * @details Glyph row 0 is written as the first bitmap row, as FontPack_ReadBdf reads it back. Characters left
+ * out of a subset font are not written.
+ */
+void FontPack_WriteBdf(const char *name, const FONT_TYPE *Font)
+{
+	unsigned int ascii_char, count = 0;
+	unsigned char row;
+
+	for(ascii_char = ' '; ascii_char <= '~'; ascii_char++)
+	{
+		if(FontPack_IsExported(Font, ascii_char) == TRUE)
+		{
+			count++;
+		}
+	}
+
+	printf("STARTFONT 2.1\nFONT %s\nSIZE %u 75 75\nFONTBOUNDINGBOX %u %u 0 0\nCHARS %u\n",
+			name, Font->Height, Font->Width, Font->Height, count);
+	for(ascii_char = ' '; ascii_char <= '~'; ascii_char++)
+	{
+		if(FontPack_IsExported(Font, ascii_char) == FALSE)
+		{
+			continue;
+		}
+
+		printf("STARTCHAR U+%04X\nENCODING %u\nSWIDTH %u 0\nDWIDTH %u 0\nBBX %u %u 0 0\nBITMAP\n",
+				ascii_char, ascii_char, 72000 * Font->Width / 75 / Font->Height, Font->Width, Font->Width, Font->Height);
+		for(row = 0; row < Font->Height; row++)
+		{
+			//Leftmost pixel in the top bit of whole bytes
+			if(Font->Width > 8)
+			{
+				printf("%04X\n", FontPack_Reverse(Fonts_GetRow(Font, ascii_char, row), 16));
+			}
+			else
+			{
+				printf("%02X\n", FontPack_Reverse(Fonts_GetRow(Font, ascii_char, row), 8));
+			}
+		}
+		printf("ENDCHAR\n");
+	}
+	printf("ENDFONT\n");
+}
+
+/**
+ * @brief Check character is in use and has glyph in font
+ */
+bool FontPack_IsExported(const FONT_TYPE *Font, unsigned int ascii_char)
+{
+	return ( (FontPack_IsUsed[ascii_char] == TRUE) && (ascii_char >= Font->FirstChar) && (ascii_char <= Font->LastChar) &&
+			( (Font->Chars == NULL) || (strchr(Font->Chars, (int)ascii_char) != NULL) ) ) ? TRUE : FALSE;
+}
+
+/**
+ * @brief Reverse order of lowest count bits, bit 0 becomes bit count - 1
+ */
+unsigned short FontPack_Reverse(unsigned short bits, unsigned char count)
+{
+	unsigned short reversed = 0;
+
+	for(; count > 0; count--, bits >>= 1)
+	{
+		reversed = (unsigned short)( (reversed << 1) | (bits & 0x01) );
+	}
+
+	return reversed;
+}
+
+/**
+ * @brief Set pixel of glyph read from file, pixels outside glyph cell are dropped
+ *
+ * @param column - column in cell, 0 is the leftmost one
+ * @param row - row in cell counted from the first bitmap row, glyph row 0
+ */
+void FontPack_SetPixel(FONT_PACK_SOURCE_TYPE *Source, unsigned int ascii_char, int column, int row)
+{
+	if( (column >= 0) && (column < Source->Font.Width) && (row >= 0) && (row < Source->Font.Height) )
+	{
+		Source->Rows[(ascii_char - ' ') * Source->Font.Height + row] |= (unsigned short)(1 << column);
+	}
+}
+
+/**
+ * @brief Pack glyphs of characters in use and set up descriptor of packed font
+ */
+void FontPack_Pack(FONT_PACK_TYPE *Pack, const FONT_TYPE *Font)
+{
+	unsigned int ascii_char;
+
+	for(ascii_char = Font->FirstChar; ascii_char <= Font->LastChar; ascii_char++)
+	{
+		if(FontPack_IsUsed[ascii_char] == TRUE)
+		{
+			Pack->Bit = (Pack->Bit + 7) & ~7UL;
+			Pack->Index[Pack->Count] = Pack->Bit / 8;
+			Pack->Chars[Pack->Count++] = (char)ascii_char;
+			FontPack_PackGlyph(Pack, Font, ascii_char);
+		}
+	}
+	//Padding read by Fonts_ReadRow past the last glyph
+	Pack->Bit = ( (Pack->Bit + 7) & ~7UL ) + 16;
+
+	Pack->Font = *Font;
+	Pack->Font.IsMsbFirst = FALSE;
+	Pack->Font.WideRows = NULL;
+	Pack->Font.NarrowRows = NULL;
+	Pack->Font.PackedRows = Pack->Rows;
+	Pack->Font.PackedIndex = Pack->Index;
+	Pack->Font.Chars = (FontPack_IsSubset == TRUE) ? Pack->Chars : NULL;
+
+	//Font without glyphs has empty range
+	Pack->Font.FirstChar = (Pack->Count > 0) ? (unsigned char)Pack->Chars[0] : 0xFF;
+	Pack->Font.LastChar = (Pack->Count > 0) ? (unsigned char)Pack->Chars[Pack->Count - 1] : 0;
+}
+
+/**
+ * @brief Append bits to packed data, bit 0 first
+ */
+void FontPack_WriteBits(FONT_PACK_TYPE *Pack, unsigned short bits, unsigned char count)
+{
+	for(; count > 0; count--, bits >>= 1, Pack->Bit++)
+	{
+		if( (bits & 0x01) != 0 )
+		{
+			Pack->Rows[Pack->Bit / 8] |= (unsigned char)(1 << (Pack->Bit % 8));
+		}
+	}
+}
+
+/**
+ * @brief Append glyph of character trimmed to its ink bounds
+ */
+void FontPack_PackGlyph(FONT_PACK_TYPE *Pack, const FONT_TYPE *Font, unsigned char ascii_char)
+{
+	unsigned short rows[FONT_PACK_MAX_HEIGHT];
+	unsigned short ink = 0;
+	unsigned char top, bottom, left, right, row;
+
+	//Rows top one first, as Fonts_ReadRow reads them
+	for(row = 0; row < Font->Height; row++)
+	{
+		rows[row] = Fonts_GetRow(Font, ascii_char, Font->Height - 1 - row);
+		ink |= rows[row];
+	}
+
+	if(ink == 0)
+	{
+		FontPack_WriteBits(Pack, 0, 24);
+		return;
+	}
+
+	for(top = 0; rows[top] == 0; top++)
+	{
+		do{}while(0);
+	}
+	for(bottom = Font->Height - 1; rows[bottom] == 0; bottom--)
+	{
+		do{}while(0);
+	}
+	for(left = 0; (ink & (1 << left)) == 0; left++)
+	{
+		do{}while(0);
+	}
+	for(right = 15; (ink & (1 << right)) == 0; right--)
+	{
+		do{}while(0);
+	}
+
+	FontPack_WriteBits(Pack, (unsigned short)( (left << 4) | (right - left) ), 8);
+	FontPack_WriteBits(Pack, top, 8);
+	FontPack_WriteBits(Pack, bottom - top + 1, 8);
+
+	for(row = top; row <= bottom; row++)
+	{
+		if( (row > top) && (rows[row] == rows[row - 1]) )
+		{
+			FontPack_WriteBits(Pack, 0, 1);
+		}
+		else
+		{
+			FontPack_WriteBits(Pack, 1, 1);
+			FontPack_WriteBits(Pack, rows[row] >> left, right - left + 1);
+		}
+	}
+}
+
+/**
+ * @brief Check every row of every glyph, read in sequence and at random, is the same as in source font,
+ * characters left out of packed font are blank
+ */
+bool FontPack_Verify(const FONT_TYPE *Font, const FONT_TYPE *Packed)
+{
+	FONT_READER_TYPE Reader;
+	unsigned short expected;
+	unsigned int ascii_char;
+	unsigned char row;
+
+	for(ascii_char = 0; ascii_char < 256; ascii_char++)
+	{
+		Fonts_OpenGlyph(&Reader, Packed, ascii_char);
+		for(row = Font->Height; row > 0; row--)
+		{
+			expected = (FontPack_IsUsed[ascii_char] == TRUE) ? Fonts_GetRow(Font, ascii_char, row - 1) : 0;
+			if( (Fonts_ReadRow(&Reader) != expected) || (Fonts_GetRow(Packed, ascii_char, row - 1) != expected) )
+			{
+				return FALSE;
+			}
+		}
+	}
+
+	return TRUE;
+}
+
+/**
+ * @brief Time reading all rows of every glyph of font with Fonts_ReadRow
+ *
+ * @return nanoseconds per glyph
+ */
+double FontPack_Bench(const FONT_TYPE *Font)
+{
+	FONT_READER_TYPE Reader;
+	unsigned short rows = 0;
+	unsigned int round, ascii_char, glyphs = 0;
+	unsigned char row;
+	clock_t start = clock();
+
+	for(round = 0; round < FONT_PACK_BENCH_ROUNDS; round++)
+	{
+		for(ascii_char = Font->FirstChar; ascii_char <= Font->LastChar; ascii_char++)
+		{
+			if(FontPack_IsUsed[ascii_char] == FALSE)
+			{
+				continue;
+			}
+
+			Fonts_OpenGlyph(&Reader, Font, ascii_char);
+			for(row = 0; row < Font->Height; row++)
+			{
+				rows ^= Fonts_ReadRow(&Reader);
+			}
+			glyphs++;
+		}
+	}
+	FontPack_Sink = rows;
+
+	return (glyphs > 0) ? 1e9 * (double)(clock() - start) / CLOCKS_PER_SEC / glyphs : 0.0;
+}
+
+/**
+ * @brief Write packed rows, glyph index and characters of subset font as C arrays, one glyph per line
+ */
+void FontPack_Print(const char *name, const FONT_PACK_TYPE *Pack)
+{
+	unsigned int glyph, offset, end;
+
+	printf("/**\n  * @brief  %s glyphs, %ux%u cell, packed to glyph bounds\n  */\n", name, Pack->Font.Width, Pack->Font.Height);
+	printf("static const unsigned char %s_Packed_Rows[] =\n{\n", name);
+	for(glyph = 0; glyph <= Pack->Count; glyph++)
+	{
+		//Padding bytes follow the last glyph
+		offset = (glyph < Pack->Count) ? Pack->Index[glyph] : Pack->Bit / 8 - 2;
+		end = (glyph + 1 < Pack->Count) ? Pack->Index[glyph + 1] : Pack->Bit / 8 - ( (glyph < Pack->Count) ? 2 : 0 );
+
+		printf("\t");
+		for(; offset < end; offset++)
+		{
+			printf("0x%02X,%s", Pack->Rows[offset], (offset + 1 < end) ? " " : "");
+		}
+		if(glyph < Pack->Count)
+		{
+			printf("\t/* '%c' %u */\n", Pack->Chars[glyph], (unsigned char)Pack->Chars[glyph]);
+		}
+		else
+		{
+			printf("\t/* padding */\n");
+		}
+	}
+	printf("};\n\n");
+
+	printf("static const unsigned short %s_Packed_Index[] =\n{", name);
+	for(glyph = 0; glyph < Pack->Count; glyph++)
+	{
+		printf("%s%u%s", (glyph % 16 == 0) ? "\n\t" : " ", Pack->Index[glyph], (glyph + 1 < Pack->Count) ? "," : "");
+	}
+	printf("%s\n};\n\n", (Pack->Count == 0) ? "\n\t0" : "");
+
+	if(FontPack_IsSubset == TRUE)
+	{
+		printf("static const char %s_Packed_Chars[] = \"", name);
+		for(glyph = 0; glyph < Pack->Count; glyph++)
+		{
+			//Escaped '?' never starts a trigraph
+			printf("%s%c", ( (Pack->Chars[glyph] == '"') || (Pack->Chars[glyph] == '\\') || (Pack->Chars[glyph] == '?') ) ? "\\" : "",
+					Pack->Chars[glyph]);
+		}
+		printf("\";\n\n");
+	}
+}